@@ -0,0 +1,317 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include "GRIT/compact_format.h"
+#include "GRIT/hypergraph.h"
+#include "GRIT/npy.h"
+#include "GRIT/utility.h"
+#include "GRIT/inference-models/phg.h"
+#include "GRIT/inference-models/pes.h"
+#include "GRIT/inference-models/per.h"
+
+
+namespace fs = boost::filesystem;
+namespace pt = boost::property_tree;
+
+
+static const std::string USAGE =
+    "Usage: grit-sample MODEL OBSERVATIONS OUTPUT_DIRECTORY -c CONFIG [-c CONFIG ...] [options]\n"
+    "\n"
+    "Samples the posterior of MODEL (phg, pes or per) given the observations matrix saved with\n"
+    "numpy.save. Chains are written to OUTPUT_DIRECTORY/chain<i>/ like modeling.models.sample.\n"
+    "\n"
+    "Options:\n"
+    "  -c, --config FILE         JSON configuration with the \"sampling\" and \"models\" sections of\n"
+    "                            config/default.json. Later files override earlier ones.\n"
+    "  --hypergraph PATH         Initial hypergraph, either a compact file or the prefix of the\n"
+    "                            \"_edges\" and \"_triangles\" files. Defaults to the pairs observed\n"
+    "                            more than twice.\n"
+    "  --parameters P0 ... P4    Initial parameters. Defaults to proportions and observation means\n"
+    "                            of the edge types of the initial hypergraph.\n"
+    "  --chains N                Overrides \"chain number\".\n"
+    "  --seed S                  Seed of the random number generator.\n";
+
+
+// Values are searched from the last configuration file to the first, like the
+// ConfigHandler of the Python scripts. Paths are separated by '/'.
+class Configuration {
+    std::vector<pt::ptree> trees;
+
+    public:
+        void addFile(const std::string& fileName) {
+            trees.emplace_back();
+            pt::read_json(fileName, trees.back());
+        }
+        bool isEmpty() const { return trees.empty(); }
+
+        template<typename T>
+        T get(const std::string& path) const {
+            return getTree(path).get_value<T>();
+        }
+
+        template<typename T>
+        std::vector<T> getArray(const std::string& path) const {
+            std::vector<T> values;
+            for (auto& child: getTree(path))
+                values.push_back(child.second.get_value<T>());
+            return values;
+        }
+
+    private:
+        const pt::ptree& getTree(const std::string& path) const {
+            for (auto tree=trees.rbegin(); tree!=trees.rend(); tree++) {
+                auto child = tree->get_child_optional(pt::ptree::path_type(path, '/'));
+                if (child)
+                    return *child;
+            }
+            throw std::runtime_error("Configuration key \""+path+"\" not found.");
+        }
+};
+
+struct Arguments {
+    std::string model, observationsFile, outputDirectory, hypergraphPath;
+    GRIT::Parameters parameters;
+    Configuration config;
+    size_t chainNumber = 0;
+    bool hasSeed = false;
+    unsigned int seed = 0;
+};
+
+
+static Arguments parseArguments(int argc, char* argv[]) {
+    Arguments arguments;
+    std::vector<std::string> positionals;
+
+    auto getValue = [&](int& i) -> std::string {
+        if (i+1 >= argc)
+            throw std::invalid_argument(std::string("Missing value of option ")+argv[i]+".");
+        return argv[++i];
+    };
+
+    for (int i=1; i<argc; i++) {
+        std::string argument(argv[i]);
+
+        if (argument == "-h" || argument == "--help") {
+            std::cout << USAGE;
+            exit(0);
+        }
+        else if (argument == "-c" || argument == "--config")
+            arguments.config.addFile(getValue(i));
+        else if (argument == "--hypergraph")
+            arguments.hypergraphPath = getValue(i);
+        else if (argument == "--parameters")
+            for (size_t p=0; p<5; p++)
+                arguments.parameters.push_back(std::stod(getValue(i)));
+        else if (argument == "--chains")
+            arguments.chainNumber = std::stoul(getValue(i));
+        else if (argument == "--seed") {
+            arguments.hasSeed = true;
+            arguments.seed = std::stoul(getValue(i));
+        }
+        else if (!argument.empty() && argument[0] == '-')
+            throw std::invalid_argument("Unknown option "+argument+".");
+        else
+            positionals.push_back(argument);
+    }
+
+    if (positionals.size() != 3)
+        throw std::invalid_argument("Expected a model, an observations file and an output directory.");
+    if (arguments.config.isEmpty())
+        throw std::invalid_argument("At least one configuration file is required (e.g. config/default.json).");
+
+    arguments.model = positionals[0];
+    arguments.observationsFile = positionals[1];
+    arguments.outputDirectory = positionals[2];
+    if (arguments.outputDirectory.back() != '/')
+        arguments.outputDirectory += '/';
+    if (arguments.chainNumber == 0)
+        arguments.chainNumber = arguments.config.get<size_t>("sampling/chain number");
+    return arguments;
+}
+
+
+static std::unique_ptr<InferenceModel> createModel(const std::string& name, const Configuration& config) {
+    std::string section = "models/"+name+"/";
+    auto windowSize = config.get<size_t>(section+"window size");
+    auto tolerance = config.get<double>(section+"tolerance");
+    auto mhMinimumIterations = config.get<size_t>(section+"mh minimum iterations");
+    auto mhMaximumIterations = config.get<size_t>(section+"mh maximum iterations");
+    auto eta = config.get<double>(section+"eta");
+    auto hyperparameters = config.getArray<double>(section+"hyperparameters");
+    auto moveProbabilities = config.getArray<double>(section+"move probabilities");
+
+    if (name == "phg")
+        return std::make_unique<PHG>(windowSize, tolerance, mhMinimumIterations, mhMaximumIterations, eta,
+                config.get<double>(section+"chi_0"), config.get<double>(section+"chi_1"), hyperparameters, moveProbabilities);
+    if (name == "pes")
+        return std::make_unique<PES>(windowSize, tolerance, mhMinimumIterations, mhMaximumIterations, eta, hyperparameters, moveProbabilities);
+    if (name == "per")
+        return std::make_unique<PER>(windowSize, tolerance, mhMinimumIterations, mhMaximumIterations, eta, hyperparameters, moveProbabilities);
+    throw std::invalid_argument("Unknown model \""+name+"\". Expected \"phg\", \"pes\" or \"per\".");
+}
+
+// Same as modeling.models: pairs observed more than twice are edges and
+// the graph models only keep the projection of the hypergraph.
+static GRIT::Hypergraph getInitialHypergraph(const Arguments& arguments, const GRIT::Observations& observations) {
+    size_t n = observations.size();
+    GRIT::Hypergraph hypergraph(n);
+
+    if (arguments.hypergraphPath.empty()) {
+        for (size_t i=0; i<n; i++)
+            for (size_t j=i+1; j<n; j++)
+                if (observations[i][j] > 2)
+                    hypergraph.addEdge(i, j);
+    }
+    else if (GRIT::CompactHypergraphFile::isCompactHypergraph(arguments.hypergraphPath))
+        hypergraph = GRIT::Hypergraph::loadFromCompactBinary(arguments.hypergraphPath);
+    else
+        hypergraph = GRIT::Hypergraph::loadFromBinary(arguments.hypergraphPath);
+
+    if (hypergraph.getSize() != n)
+        throw std::runtime_error("The initial hypergraph and the observations have different sizes.");
+    if (arguments.model == "phg")
+        return hypergraph;
+
+    GRIT::Hypergraph graph(n);
+    for (size_t i=0; i<n; i++)
+        for (size_t j=i+1; j<n; j++)
+            if (hypergraph.getHighestOrderHyperedgeWith(i, j) > 0)
+                graph.addEdge(i, j);
+    return graph;
+}
+
+// Edge type proportions of the hypergraph and mean observations of each type. Edge types
+// absent from the hypergraph take the mean of the previous type.
+static GRIT::Parameters estimateParameters(const std::string& model, const GRIT::Hypergraph& hypergraph, const GRIT::Observations& observations) {
+    size_t n = hypergraph.getSize();
+    double pairNumber = GRIT::nchoose2(n);
+    std::array<double, 3> typeNumbers {0, 0, 0}, observationSums {0, 0, 0};
+
+    for (size_t i=0; i<n; i++)
+        for (size_t j=i+1; j<n; j++) {
+            size_t type = model == "phg" ? hypergraph.getHighestOrderHyperedgeWith(i, j)
+                                         : std::min(hypergraph.getEdgeMultiplicity(i, j), (size_t) 2);
+            typeNumbers[type]++;
+            observationSums[type] += observations[i][j];
+        }
+
+    std::array<double, 3> proportions, means;
+    for (size_t type=0; type<3; type++) {
+        proportions[type] = typeNumbers[type]/pairNumber;
+        means[type] = typeNumbers[type] > 0 ? observationSums[type]/typeNumbers[type] : (type > 0 ? means[type-1] : 0);
+    }
+
+    GRIT::Parameters parameters;
+    if (model == "phg")
+        parameters = {1-pow(1-proportions[2], 1./(n-2)), proportions[1]*(1-proportions[2]), means[0], means[1], means[2]};
+    else if (model == "pes")
+        parameters = {proportions[1], proportions[2], means[0], means[1], means[2]};
+    else
+        parameters = {proportions[1], 0, means[0], means[1], 0};
+
+    for (auto& parameter: parameters)
+        if (parameter == 0)
+            parameter = 1e-8;
+    return parameters;
+}
+
+
+int main(int argc, char* argv[]) {
+    Arguments arguments;
+    try {
+        arguments = parseArguments(argc, argv);
+    }
+    catch (const std::exception& error) {
+        std::cerr << error.what() << "\n\n" << USAGE;
+        return 2;
+    }
+
+    try {
+        if (arguments.hasSeed)
+            GRIT::generator.seed(arguments.seed);
+
+        auto model = createModel(arguments.model, arguments.config);
+        model->setSampleFormat(arguments.config.get<std::string>("sampling/sample format"));
+        model->setCheckpointInterval(arguments.config.get<size_t>("sampling/checkpoint interval"));
+        model->setCanonicalizationInterval(arguments.config.get<size_t>("sampling/canonicalization interval"));
+        model->setAdaptiveMoves(arguments.config.get<bool>("models/"+arguments.model+"/adaptive moves"));
+        auto sampleSize = arguments.config.get<size_t>("sampling/sample size");
+        auto burnin = arguments.config.get<size_t>("sampling/burnin");
+        auto keepOnlyBestChain = arguments.config.get<bool>("sampling/keep only best chain");
+
+        auto observations = GRIT::loadObservationsFromNpy(arguments.observationsFile);
+        auto initialHypergraph = getInitialHypergraph(arguments, observations);
+        auto initialParameters = arguments.parameters.empty() ?
+            estimateParameters(arguments.model, initialHypergraph, observations) : arguments.parameters;
+
+        fs::create_directories(arguments.outputDirectory);
+
+        bool hasBestChain = false;
+        size_t bestChain = 0;
+        double maximumLikelihood = 0;
+        GRIT::SamplingStatistics totalStatistics;
+        double totalSeconds = 0;
+
+        for (size_t chain=0; chain<arguments.chainNumber; chain++) {
+            std::string chainDirectory = arguments.outputDirectory+"chain"+std::to_string(chain)+"/";
+            fs::remove_all(chainDirectory);
+            fs::create_directories(chainDirectory);
+
+            auto hypergraph = initialHypergraph;
+            auto parameters = initialParameters;
+            double averageLikelihood;
+
+            auto start = std::chrono::steady_clock::now();
+            try {
+                averageLikelihood = model->sample(sampleSize, burnin, chain, hypergraph, parameters, observations, chainDirectory);
+            }
+            catch (const std::runtime_error& error) {
+                std::cerr << "Catched sampling error: \"" << error.what() << "\". Erasing chain " << chain << "." << std::endl;
+                fs::remove_all(chainDirectory);
+                continue;
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+
+            auto statistics = model->getSamplingStatistics();
+            totalStatistics.gibbsIterations += statistics.gibbsIterations;
+            totalStatistics.metropolisHastingsSteps += statistics.metropolisHastingsSteps;
+            totalSeconds += seconds;
+            printf("\nChain %lu: %lu Gibbs iterations and %lu MH steps in %.2f s (%.3g iterations/s, %.3g MH steps/s)\n",
+                    chain, statistics.gibbsIterations, statistics.metropolisHastingsSteps, seconds,
+                    statistics.gibbsIterations/seconds, statistics.metropolisHastingsSteps/seconds);
+
+            if (!hasBestChain || averageLikelihood > maximumLikelihood) {
+                hasBestChain = true;
+                bestChain = chain;
+                maximumLikelihood = averageLikelihood;
+            }
+        }
+
+        if (keepOnlyBestChain && hasBestChain)
+            for (size_t chain=0; chain<arguments.chainNumber; chain++)
+                if (chain != bestChain)
+                    fs::remove_all(arguments.outputDirectory+"chain"+std::to_string(chain)+"/");
+
+        if (totalSeconds > 0)
+            printf("Total: %lu Gibbs iterations and %lu MH steps in %.2f s (%.3g iterations/s, %.3g MH steps/s)\n",
+                    totalStatistics.gibbsIterations, totalStatistics.metropolisHastingsSteps, totalSeconds,
+                    totalStatistics.gibbsIterations/totalSeconds, totalStatistics.metropolisHastingsSteps/totalSeconds);
+        return hasBestChain ? 0 : 1;
+    }
+    catch (const std::exception& error) {
+        std::cerr << "Error: " << error.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,132 @@
+#include <benchmark/benchmark.h>
+
+#include "GRIT/proposers/edge-choosers/uniform_edge_chooser.h"
+#include "GRIT/proposers/edge-choosers/weighted_unique_chooser.h"
+#include "GRIT/proposers/edge-choosers/weighted_two-layers_chooser.h"
+#include "GRIT/proposers/triangle-choosers/observations_by_pairs_chooser.h"
+#include "GRIT/proposers/triangle-choosers/uniform_triangle_chooser.h"
+#include "fixtures.h"
+
+
+using namespace GRIT;
+
+
+// Arguments: number of vertices, average degree
+static void sizesAndDensities(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgsProduct({{100, 1000}, {2, 20}});
+}
+
+template<typename Chooser>
+static Hypergraph getGraphFor(size_t size, size_t averageDegree) {
+    return getRandomHypergraph(size, averageDegree);
+}
+
+template<>
+Hypergraph getGraphFor<TwoLayersObservationsWeightedEdgeChooser>(size_t size, size_t averageDegree) {
+    return getRandomGraph(size, averageDegree, 2);
+}
+
+// Choosers are updated before the hypergraph, as in the proposers
+template<typename Chooser>
+static void addThenRemoveEdge(Chooser& chooser, Hypergraph& hypergraph, const Edge& edge) {
+    chooser.updateProbabilities(edge, ADD);
+    hypergraph.addEdge(edge.first, edge.second);
+    chooser.updateProbabilities(edge, REMOVE);
+    hypergraph.removeEdge(edge.first, edge.second);
+}
+
+template<typename Chooser>
+static void addThenRemoveTriangle(Chooser& chooser, Hypergraph& hypergraph, const Triplet& triplet) {
+    chooser.updateProbabilities(triplet, ADD);
+    hypergraph.addTriangle(triplet);
+    chooser.updateProbabilities(triplet, REMOVE);
+    hypergraph.removeTriangle(triplet);
+}
+
+
+template<typename Chooser>
+static void BM_EdgeChooser_choose(benchmark::State& state) {
+    generator.seed(FIXTURE_SEED);
+    auto hypergraph = getGraphFor<Chooser>(state.range(0), state.range(1));
+    auto observations = getObservationsOf(hypergraph, getBenchmarkParameters());
+    Chooser chooser(observations, hypergraph);
+
+    for (auto _: state)
+        benchmark::DoNotOptimize(chooser.choose());
+}
+BENCHMARK_TEMPLATE(BM_EdgeChooser_choose, ObservationsWeightedUniqueEdgeChooser)->Apply(sizesAndDensities);
+BENCHMARK_TEMPLATE(BM_EdgeChooser_choose, TwoLayersObservationsWeightedEdgeChooser)->Apply(sizesAndDensities);
+
+static void BM_UniformNonEdgeChooser_choose(benchmark::State& state) {
+    generator.seed(FIXTURE_SEED);
+    auto hypergraph = getRandomHypergraph(state.range(0), state.range(1));
+    UniformNonEdgeChooser chooser(hypergraph);
+
+    for (auto _: state)
+        benchmark::DoNotOptimize(chooser.choose());
+}
+BENCHMARK(BM_UniformNonEdgeChooser_choose)->Apply(sizesAndDensities);
+
+template<typename Chooser>
+static void BM_EdgeChooser_updateProbabilities(benchmark::State& state) {
+    auto hypergraph = getGraphFor<Chooser>(state.range(0), state.range(1));
+    auto observations = getObservationsOf(hypergraph, getBenchmarkParameters());
+    auto pairs = getRandomPairs(state.range(0), 1024);
+    Chooser chooser(observations, hypergraph);
+
+    size_t n = 0;
+    for (auto _: state)
+        addThenRemoveEdge(chooser, hypergraph, pairs[n++ % pairs.size()]);
+}
+BENCHMARK_TEMPLATE(BM_EdgeChooser_updateProbabilities, ObservationsWeightedUniqueEdgeChooser)->Apply(sizesAndDensities);
+BENCHMARK_TEMPLATE(BM_EdgeChooser_updateProbabilities, TwoLayersObservationsWeightedEdgeChooser)->Apply(sizesAndDensities);
+
+static void BM_UniformNonEdgeChooser_updateProbabilities(benchmark::State& state) {
+    auto hypergraph = getRandomHypergraph(state.range(0), state.range(1));
+    auto pairs = getRandomPairs(state.range(0), 1024);
+    UniformNonEdgeChooser chooser(hypergraph);
+
+    size_t n = 0;
+    for (auto _: state)
+        addThenRemoveEdge(chooser, hypergraph, pairs[n++ % pairs.size()]);
+}
+BENCHMARK(BM_UniformNonEdgeChooser_updateProbabilities)->Apply(sizesAndDensities);
+
+
+static void BM_ObservationsPairwiseTriangleChooser_choose(benchmark::State& state) {
+    generator.seed(FIXTURE_SEED);
+    auto hypergraph = getRandomHypergraph(state.range(0), state.range(1));
+    auto observations = getObservationsOf(hypergraph, getBenchmarkParameters());
+    ObservationsPairwiseTriangleChooser chooser(observations);
+
+    for (auto _: state)
+        benchmark::DoNotOptimize(chooser.choose());
+}
+BENCHMARK(BM_ObservationsPairwiseTriangleChooser_choose)->Apply(sizesAndDensities);
+
+static void BM_UniformTriangleChooser_choose(benchmark::State& state) {
+    generator.seed(FIXTURE_SEED);
+    auto hypergraph = getRandomHypergraph(state.range(0), state.range(1));
+    UniformTriangleChooser chooser(hypergraph);
+
+    for (auto _: state)
+        benchmark::DoNotOptimize(chooser.choose());
+}
+BENCHMARK(BM_UniformTriangleChooser_choose)->Apply(sizesAndDensities);
+
+static void BM_UniformTriangleChooser_updateProbabilities(benchmark::State& state) {
+    auto hypergraph = getRandomHypergraph(state.range(0), state.range(1));
+    auto pairs = getRandomPairs(state.range(0), 1024);
+    auto thirdVertices = getRandomPairs(state.range(0), 1024, FIXTURE_SEED+1);
+    UniformTriangleChooser chooser(hypergraph);
+
+    size_t n = 0;
+    for (auto _: state) {
+        Triplet triplet {pairs[n % pairs.size()].first, pairs[n % pairs.size()].second, thirdVertices[n % thirdVertices.size()].first};
+        n++;
+        if (triplet.k == triplet.i || triplet.k == triplet.j || hypergraph.isTriangle(triplet))
+            continue;
+        addThenRemoveTriangle(chooser, hypergraph, triplet);
+    }
+}
+BENCHMARK(BM_UniformTriangleChooser_updateProbabilities)->Apply(sizesAndDensities);
@@ -0,0 +1,46 @@
+#include <array>
+#include <benchmark/benchmark.h>
+
+#include "GRIT/utility.h"
+#include "fixtures.h"
+
+
+using namespace GRIT;
+
+
+// (inf, sup, k, theta) of the truncated gammas drawn by the parameter samplers
+static const std::array<std::array<double, 4>, 7> truncatedGammaCases {{
+    {MEAN_MIN, 1,        1000, 1./5000},  // mu0 of a sparse hypergraph
+    {0.2,      MEAN_MAX, 5000, 1./1000},  // mu1 with many edges
+    {0.2,      MEAN_MAX, 12,   1./2},     // mu2 with few triangles
+    {3,        MEAN_MAX, 1.5,  2},        // Truncation in the tail
+    {0.01,     1,        0.5,  1},        // k < 1
+    {30,       40,       2,    1},        // Far in the upper tail
+    {0.1,      0.2,      50,   1}         // Far in the lower tail
+}};
+
+static void BM_drawFromTruncatedGamma(benchmark::State& state) {
+    generator.seed(FIXTURE_SEED);
+    const auto& parameters = truncatedGammaCases[state.range(0)];
+
+    for (auto _: state)
+        benchmark::DoNotOptimize(drawFromTruncatedGamma(parameters[0], parameters[1], parameters[2], parameters[3]));
+}
+BENCHMARK(BM_drawFromTruncatedGamma)->DenseRange(0, truncatedGammaCases.size()-1);
+
+static void BM_drawFromTruncatedGammaITS(benchmark::State& state) {
+    generator.seed(FIXTURE_SEED);
+    const auto& parameters = truncatedGammaCases[state.range(0)];
+
+    for (auto _: state)
+        benchmark::DoNotOptimize(drawFromTruncatedGammaITS(parameters[0], parameters[1], parameters[2], parameters[3]));
+}
+BENCHMARK(BM_drawFromTruncatedGammaITS)->DenseRange(0, truncatedGammaCases.size()-1);
+
+static void BM_drawFromBeta(benchmark::State& state) {
+    generator.seed(FIXTURE_SEED);
+
+    for (auto _: state)
+        benchmark::DoNotOptimize(drawFromBeta(state.range(0), 1000));
+}
+BENCHMARK(BM_drawFromBeta)->Arg(2)->Arg(100);
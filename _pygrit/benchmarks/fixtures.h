@@ -0,0 +1,97 @@
+#ifndef GRIT_BENCHMARK_FIXTURES_H
+#define GRIT_BENCHMARK_FIXTURES_H
+
+#include <random>
+#include <vector>
+
+#include "GRIT/utility.h"
+#include "GRIT/hypergraph.h"
+
+
+// Synthetic inputs are drawn from their own engine so that they don't depend on
+// what the benchmarks previously drew from GRIT::generator.
+const unsigned int FIXTURE_SEED = 42;
+
+// Random hypergraph where each vertex is, on average, in "averageDegree" edges
+// and "averageDegree"/2 triangles.
+inline GRIT::Hypergraph getRandomHypergraph(size_t size, size_t averageDegree, unsigned int seed=FIXTURE_SEED) {
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<size_t> vertexDistribution(0, size-1);
+    GRIT::Hypergraph hypergraph(size);
+
+    size_t edgeNumber = size*averageDegree/2;
+    while (hypergraph.getEdgeNumber() < edgeNumber) {
+        size_t i = vertexDistribution(engine), j = vertexDistribution(engine);
+        if (i != j)
+            hypergraph.addEdge(i, j);
+    }
+
+    size_t triangleNumber = size*averageDegree/6;
+    while (hypergraph.getTriangleNumber() < triangleNumber) {
+        size_t i = vertexDistribution(engine), j = vertexDistribution(engine), k = vertexDistribution(engine);
+        if (i != j && j != k && i != k)
+            hypergraph.addTriangle({i, j, k});
+    }
+    return hypergraph;
+}
+
+// Graph without triangles whose edge multiplicities are uniform in [1, maximumMultiplicity].
+// A maximum of 2 gives the edge strength graphs of the PES model.
+inline GRIT::Hypergraph getRandomGraph(size_t size, size_t averageDegree, size_t maximumMultiplicity=1, unsigned int seed=FIXTURE_SEED) {
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<size_t> vertexDistribution(0, size-1);
+    std::uniform_int_distribution<size_t> multiplicityDistribution(1, maximumMultiplicity);
+    GRIT::Hypergraph graph(size);
+
+    size_t edgeNumber = size*averageDegree/2;
+    while (graph.getEdgeNumber() < edgeNumber) {
+        size_t i = vertexDistribution(engine), j = vertexDistribution(engine);
+        if (i != j && !graph.isEdge(i, j))
+            graph.addMultiedge(i, j, multiplicityDistribution(engine));
+    }
+    return graph;
+}
+
+inline GRIT::Parameters getBenchmarkParameters() {
+    return {0.01, 0.05, 0.5, 5, 15};
+}
+
+inline GRIT::Parameters getBenchmarkHyperparameters() {
+    return {1.1, 5, 1.1, 5, 1.0001, 0.5, 4, 0.2, 4, 0.2};
+}
+
+// Poisson observations whose mean depends on the highest order hyperedge of each pair
+inline GRIT::Observations getObservationsOf(const GRIT::Hypergraph& hypergraph, const GRIT::Parameters& parameters, unsigned int seed=FIXTURE_SEED) {
+    std::mt19937 engine(seed);
+    size_t size = hypergraph.getSize();
+    GRIT::Observations observations(size, std::vector<size_t>(size, 0));
+
+    std::poisson_distribution<size_t> distributions[3] = {
+        std::poisson_distribution<size_t>(parameters[2]),
+        std::poisson_distribution<size_t>(parameters[3]),
+        std::poisson_distribution<size_t>(parameters[4])
+    };
+    for (size_t i=0; i<size; i++)
+        for (size_t j=i+1; j<size; j++) {
+            observations[i][j] = distributions[hypergraph.getHighestOrderHyperedgeWith(i, j)](engine);
+            observations[j][i] = observations[i][j];
+        }
+    return observations;
+}
+
+// Pairs used to probe a hypergraph, drawn once so that the timed loop only queries
+inline std::vector<GRIT::Edge> getRandomPairs(size_t size, size_t pairNumber, unsigned int seed=FIXTURE_SEED) {
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<size_t> vertexDistribution(0, size-1);
+    std::vector<GRIT::Edge> pairs;
+    pairs.reserve(pairNumber);
+
+    while (pairs.size() < pairNumber) {
+        size_t i = vertexDistribution(engine), j = vertexDistribution(engine);
+        if (i != j)
+            pairs.push_back({i, j});
+    }
+    return pairs;
+}
+
+#endif
@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+
+#include "GRIT/hypergraph.h"
+#include "fixtures.h"
+
+
+using namespace GRIT;
+
+
+// Arguments: number of vertices, average degree
+static void sizesAndDensities(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgsProduct({{100, 1000, 10000}, {2, 20}});
+}
+
+
+static void BM_Hypergraph_addRemoveEdge(benchmark::State& state) {
+    auto hypergraph = getRandomHypergraph(state.range(0), state.range(1));
+    auto pairs = getRandomPairs(state.range(0), 1024);
+
+    size_t n = 0;
+    for (auto _: state) {
+        const auto& pair = pairs[n++ % pairs.size()];
+        hypergraph.addEdge(pair.first, pair.second);
+        benchmark::DoNotOptimize(hypergraph.removeEdge(pair.first, pair.second));
+    }
+}
+BENCHMARK(BM_Hypergraph_addRemoveEdge)->Apply(sizesAndDensities);
+
+static void BM_TriangleList_addRemoveTriangle(benchmark::State& state) {
+    auto hypergraph = getRandomHypergraph(state.range(0), state.range(1));
+    auto pairs = getRandomPairs(state.range(0), 1024);
+    auto thirdVertices = getRandomPairs(state.range(0), 1024, FIXTURE_SEED+1);
+
+    size_t n = 0;
+    for (auto _: state) {
+        size_t i = pairs[n % pairs.size()].first, j = pairs[n % pairs.size()].second;
+        size_t k = thirdVertices[n % thirdVertices.size()].first;
+        n++;
+        if (k == i || k == j)
+            continue;
+
+        if (hypergraph.addTriangle({i, j, k}))
+            hypergraph.removeTriangle({i, j, k});
+    }
+}
+BENCHMARK(BM_TriangleList_addRemoveTriangle)->Apply(sizesAndDensities);
+
+static void BM_Hypergraph_getEdgeMultiplicity(benchmark::State& state) {
+    auto hypergraph = getRandomHypergraph(state.range(0), state.range(1));
+    auto pairs = getRandomPairs(state.range(0), 1024);
+
+    size_t n = 0;
+    for (auto _: state) {
+        const auto& pair = pairs[n++ % pairs.size()];
+        benchmark::DoNotOptimize(hypergraph.getEdgeMultiplicity(pair.first, pair.second));
+    }
+}
+BENCHMARK(BM_Hypergraph_getEdgeMultiplicity)->Apply(sizesAndDensities);
+
+static void BM_Hypergraph_getHighestOrderHyperedgeWith(benchmark::State& state) {
+    auto hypergraph = getRandomHypergraph(state.range(0), state.range(1));
+    auto pairs = getRandomPairs(state.range(0), 1024);
+
+    size_t n = 0;
+    for (auto _: state) {
+        const auto& pair = pairs[n++ % pairs.size()];
+        benchmark::DoNotOptimize(hypergraph.getHighestOrderHyperedgeWith(pair.first, pair.second));
+    }
+}
+BENCHMARK(BM_Hypergraph_getHighestOrderHyperedgeWith)->Apply(sizesAndDensities);
+
+static void BM_TriangleList_isTriangle(benchmark::State& state) {
+    auto hypergraph = getRandomHypergraph(state.range(0), state.range(1));
+    auto pairs = getRandomPairs(state.range(0), 1024);
+    auto thirdVertices = getRandomPairs(state.range(0), 1024, FIXTURE_SEED+1);
+
+    size_t n = 0;
+    for (auto _: state) {
+        size_t i = pairs[n % pairs.size()].first, j = pairs[n % pairs.size()].second;
+        size_t k = thirdVertices[n % thirdVertices.size()].first;
+        n++;
+        benchmark::DoNotOptimize(hypergraph.isTriangle({i, j, k}));
+    }
+}
+BENCHMARK(BM_TriangleList_isTriangle)->Apply(sizesAndDensities);
+
+static void BM_TriangleList_getNthTriangleOfVertex(benchmark::State& state) {
+    auto hypergraph = getRandomHypergraph(state.range(0), state.range(1));
+
+    std::vector<Index> vertices;
+    for (Index i=0; i<hypergraph.getSize(); i++)
+        if (hypergraph.getTriangleNumberWith(i) > 0)
+            vertices.push_back(i);
+
+    size_t n = 0;
+    for (auto _: state) {
+        Index vertex = vertices[n % vertices.size()];
+        benchmark::DoNotOptimize(hypergraph.getNthTriangleOfVertex(vertex, n % hypergraph.getTriangleNumberWith(vertex)));
+        n++;
+    }
+}
+BENCHMARK(BM_TriangleList_getNthTriangleOfVertex)->Apply(sizesAndDensities);
+
+static void BM_Hypergraph_copy(benchmark::State& state) {
+    auto hypergraph = getRandomHypergraph(state.range(0), state.range(1));
+
+    for (auto _: state) {
+        Hypergraph copy(hypergraph);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_Hypergraph_copy)->Apply(sizesAndDensities);
@@ -0,0 +1,160 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+
+#include "GRIT/metropolis-hastings.hpp"
+
+#include "GRIT/observations-models/poisson_hypergraph.h"
+#include "GRIT/observations-models/poisson_edgestrength.h"
+#include "GRIT/hypergraph-models/independent_hyperedges.h"
+#include "GRIT/hypergraph-models/edgestrength.h"
+#include "GRIT/hypergraph-models/gilbert.h"
+#include "GRIT/priors/poisson_independent_hyperedges.h"
+#include "GRIT/priors/poisson_independent_edges.h"
+
+#include "GRIT/proposers/sixsteps_hypergraph.h"
+#include "GRIT/proposers/twosteps_edges.h"
+#include "GRIT/proposers/edge-choosers/uniform_edge_chooser.h"
+#include "GRIT/proposers/edge-choosers/weighted_unique_chooser.h"
+#include "GRIT/proposers/edge-choosers/weighted_two-layers_chooser.h"
+#include "GRIT/proposers/edge-choosers/weighted_pair_chooser.h"
+#include "GRIT/proposers/triangle-choosers/observations_by_pairs_chooser.h"
+#include "GRIT/proposers/triangle-choosers/uniform_triangle_chooser.h"
+#include "fixtures.h"
+
+
+using namespace GRIT;
+
+
+// Arguments: number of vertices, average degree
+static void sizesAndDensities(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgsProduct({{100, 1000}, {2, 20}});
+}
+
+static const std::array<size_t, 2> mhSteps {0, 1};
+
+
+// Same assemblies as the PHG, PES and PER inference models
+struct PHGPipeline {
+    typedef MetropolisHastings<HypergraphSixStepsProposer, PoissonHypergraphObservationsModel,
+                               IndependentHyperedgesModel, PoissonHypergraph_BetaAndGammaPriors> HypergraphSampler;
+
+    Parameters parameters, hyperparameters;
+    Hypergraph hypergraph;
+    Observations observations;
+
+    ObservationsWeightedUniqueEdgeChooser edgeAdder;
+    UniformNonEdgeChooser edgeRemover;
+    ObservationsPairwiseTriangleChooser triangleAdder;
+    UniformTriangleChooser triangleRemover;
+    ObservationsWeightedPairChooser pairChooser;
+    HypergraphSixStepsProposer proposer;
+    HypergraphSampler sampler;
+
+    PHGPipeline(size_t size, size_t averageDegree, const std::vector<double>& moveProbabilities={0.4999, 0.4999, 0.0002}):
+        parameters(getBenchmarkParameters()), hyperparameters(getBenchmarkHyperparameters()),
+        hypergraph(getRandomHypergraph(size, averageDegree)), observations(getObservationsOf(hypergraph, parameters)),
+        edgeAdder(observations, hypergraph), edgeRemover(hypergraph), triangleAdder(observations), triangleRemover(hypergraph),
+        pairChooser(observations),
+        proposer(hypergraph, parameters, hyperparameters, observations,
+                 triangleAdder, triangleRemover, edgeAdder, edgeRemover, moveProbabilities),
+        sampler(hypergraph, observations, parameters, hyperparameters, proposer, mhSteps)
+    {
+        proposer.setPairChooser(pairChooser);
+    }
+};
+
+template<typename EdgeAdder, typename HypergraphModel, typename Prior, size_t maximumMultiplicity>
+struct EdgePipeline {
+    typedef MetropolisHastings<EdgeTwoStepsProposer, PoissonEdgeStrengthObservationsModel, HypergraphModel, Prior> HypergraphSampler;
+
+    Parameters parameters, hyperparameters;
+    Hypergraph hypergraph;
+    Observations observations;
+
+    EdgeAdder edgeAdder;
+    UniformNonEdgeChooser edgeRemover;
+    EdgeTwoStepsProposer proposer;
+    HypergraphSampler sampler;
+
+    EdgePipeline(size_t size, size_t averageDegree):
+        parameters(getBenchmarkParameters()), hyperparameters(getBenchmarkHyperparameters()),
+        hypergraph(getRandomGraph(size, averageDegree, maximumMultiplicity)), observations(getObservationsOf(hypergraph, parameters)),
+        edgeAdder(observations, hypergraph), edgeRemover(hypergraph),
+        proposer(hypergraph, parameters, hyperparameters, observations, edgeAdder, edgeRemover),
+        sampler(hypergraph, observations, parameters, hyperparameters, proposer, mhSteps)
+    {}
+};
+
+typedef EdgePipeline<TwoLayersObservationsWeightedEdgeChooser, EdgeStrengthGraphModel, PoissonHypergraph_BetaAndGammaPriors, 2> PESPipeline;
+typedef EdgePipeline<ObservationsWeightedUniqueEdgeChooser, GilbertGraphModel, PoissonGraph_BetaAndGammaPriors, 1> PERPipeline;
+
+
+// The chain starts from the hypergraph that generated the observations, which is
+// close to the stationary regime of a long run.
+template<typename Pipeline>
+static void BM_MetropolisHastings_advanceOneStep(benchmark::State& state) {
+    generator.seed(FIXTURE_SEED);
+    Pipeline pipeline(state.range(0), state.range(1));
+    pipeline.sampler.resetValues();
+
+    for (auto _: state)
+        pipeline.sampler.advanceOneStep();
+}
+BENCHMARK_TEMPLATE(BM_MetropolisHastings_advanceOneStep, PHGPipeline)->Apply(sizesAndDensities);
+BENCHMARK_TEMPLATE(BM_MetropolisHastings_advanceOneStep, PESPipeline)->Apply(sizesAndDensities);
+BENCHMARK_TEMPLATE(BM_MetropolisHastings_advanceOneStep, PERPipeline)->Apply(sizesAndDensities);
+
+
+// Batch means estimate with batches of sqrt(n) values. A constant chain has no effective sample.
+static double getEffectiveSampleSize(const std::vector<double>& chain) {
+    size_t batchSize = sqrt(chain.size());
+    size_t batchNumber = chain.size()/batchSize;
+    size_t n = batchSize*batchNumber;
+
+    double mean = 0;
+    for (size_t i=0; i<n; i++)
+        mean += chain[i];
+    mean /= n;
+
+    double variance = 0, batchMeansVariance = 0;
+    for (size_t batch=0; batch<batchNumber; batch++) {
+        double batchMean = 0;
+        for (size_t i=batch*batchSize; i<(batch+1)*batchSize; i++) {
+            batchMean += chain[i];
+            variance += (chain[i]-mean)*(chain[i]-mean);
+        }
+        batchMean /= batchSize;
+        batchMeansVariance += (batchMean-mean)*(batchMean-mean);
+    }
+    variance /= n-1;
+    batchMeansVariance /= batchNumber-1;
+
+    if (batchMeansVariance == 0)
+        return 0;
+    return std::min((double) n, n*variance/(batchSize*batchMeansVariance));
+}
+
+// Effective sample size per second of the edge number when the edge layer is only updated by EDGE
+// or by PAIR moves. Triangles are fixed so that both chains explore the same conditional distribution.
+static void BM_PHG_edgeLayerEffectiveSampleSize(benchmark::State& state, std::vector<double> moveProbabilities) {
+    const size_t chainLength = 20000;
+
+    generator.seed(FIXTURE_SEED);
+    PHGPipeline pipeline(state.range(0), state.range(1), moveProbabilities);
+    pipeline.sampler.resetValues();
+
+    std::vector<double> edgeNumbers(chainLength);
+    double effectiveSampleSize = 0;
+    for (auto _: state) {
+        for (size_t step=0; step<chainLength; step++) {
+            pipeline.sampler.advanceOneStep();
+            edgeNumbers[step] = pipeline.hypergraph.getEdgeNumber();
+        }
+        state.PauseTiming();
+        effectiveSampleSize += getEffectiveSampleSize(edgeNumbers);
+        state.ResumeTiming();
+    }
+    state.counters["ESS"] = benchmark::Counter(effectiveSampleSize, benchmark::Counter::kIsRate);
+}
+BENCHMARK_CAPTURE(BM_PHG_edgeLayerEffectiveSampleSize, EDGE, std::vector<double>{0, 1, 0, 0})->Apply(sizesAndDensities)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PHG_edgeLayerEffectiveSampleSize, PAIR, std::vector<double>{0, 0, 0, 1})->Apply(sizesAndDensities)->Unit(benchmark::kMillisecond);
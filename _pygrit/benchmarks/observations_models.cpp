@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+
+#include "GRIT/observations-models/poisson_hypergraph.h"
+#include "fixtures.h"
+
+
+using namespace GRIT;
+
+
+// Arguments: number of vertices, average degree
+static void sizesAndDensities(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgsProduct({{100, 1000}, {2, 20}});
+}
+
+static std::vector<SixStepsHypergraphProposal> getProposals(const Hypergraph& hypergraph, SixStepsHypergraphProposal::MoveType moveType) {
+    auto pairs = getRandomPairs(hypergraph.getSize(), 1024);
+    auto thirdVertices = getRandomPairs(hypergraph.getSize(), 1024, FIXTURE_SEED+1);
+
+    std::vector<SixStepsHypergraphProposal> proposals;
+    for (size_t n=0; n<pairs.size(); n++) {
+        SixStepsHypergraphProposal proposal;
+        proposal.moveType = moveType;
+        proposal.chosenTriplet = {pairs[n].first, pairs[n].second, thirdVertices[n].first};
+
+        if (moveType == SixStepsHypergraphProposal::EDGE)
+            proposal.move = hypergraph.isEdge(pairs[n].first, pairs[n].second) ? REMOVE : ADD;
+        else {
+            auto& triplet = proposal.chosenTriplet;
+            if (triplet.k == triplet.i || triplet.k == triplet.j)
+                continue;
+            proposal.move = hypergraph.isTriangle(triplet) ? REMOVE : ADD;
+        }
+        proposals.push_back(proposal);
+    }
+    return proposals;
+}
+
+
+static void BM_PoissonHypergraphObservationsModel_edgeDelta(benchmark::State& state) {
+    auto parameters = getBenchmarkParameters();
+    auto hypergraph = getRandomHypergraph(state.range(0), state.range(1));
+    auto observations = getObservationsOf(hypergraph, parameters);
+    auto proposals = getProposals(hypergraph, SixStepsHypergraphProposal::EDGE);
+    PoissonHypergraphObservationsModel model(hypergraph, parameters, observations);
+
+    size_t n = 0;
+    for (auto _: state)
+        benchmark::DoNotOptimize(model(proposals[n++ % proposals.size()]));
+}
+BENCHMARK(BM_PoissonHypergraphObservationsModel_edgeDelta)->Apply(sizesAndDensities);
+
+static void BM_PoissonHypergraphObservationsModel_triangleDelta(benchmark::State& state) {
+    auto parameters = getBenchmarkParameters();
+    auto hypergraph = getRandomHypergraph(state.range(0), state.range(1));
+    auto observations = getObservationsOf(hypergraph, parameters);
+    auto proposals = getProposals(hypergraph, SixStepsHypergraphProposal::TRIANGLE);
+    PoissonHypergraphObservationsModel model(hypergraph, parameters, observations);
+
+    size_t n = 0;
+    for (auto _: state)
+        benchmark::DoNotOptimize(model(proposals[n++ % proposals.size()]));
+}
+BENCHMARK(BM_PoissonHypergraphObservationsModel_triangleDelta)->Apply(sizesAndDensities);
+
+static void BM_PoissonHypergraphObservationsModel_getLoglikelihood(benchmark::State& state) {
+    auto parameters = getBenchmarkParameters();
+    auto hypergraph = getRandomHypergraph(state.range(0), state.range(1));
+    auto observations = getObservationsOf(hypergraph, parameters);
+    PoissonHypergraphObservationsModel model(hypergraph, parameters, observations);
+
+    for (auto _: state)
+        benchmark::DoNotOptimize(model.getLoglikelihood());
+    state.SetItemsProcessed(state.iterations()*nchoose2(hypergraph.getSize()));
+}
+BENCHMARK(BM_PoissonHypergraphObservationsModel_getLoglikelihood)->Apply(sizesAndDensities)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,45 @@
+#ifndef GRIT_AVERAGE_HYPERGRAPH_H
+#define GRIT_AVERAGE_HYPERGRAPH_H
+
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "GRIT/hypergraph.h"
+
+
+namespace GRIT {
+
+// Occurrences of the hyperedges of a sample of hypergraphs. With "edgeStrength", edges of multiplicity
+// 1 and above 1 are counted separately as weak and strong edges and triangles are ignored.
+class AverageHypergraphAccumulator {
+    public:
+        explicit AverageHypergraphAccumulator(bool edgeStrength=false): edgeStrength(edgeStrength) {}
+
+        void add(const Hypergraph& hypergraph);
+        void merge(const AverageHypergraphAccumulator& other);
+        size_t getSampleSize() const { return sampleSize; }
+
+        // Hyperedges found in at least a fraction "threshold" of the sample. Strong edges have multiplicity 2.
+        Hypergraph getAverageHypergraph(double threshold=0.5) const;
+
+    private:
+        bool edgeStrength;
+        size_t size = 0;
+        size_t sampleSize = 0;
+
+        // Keys are i*size+j for pairs and (i*size+j)*size+k for triangles, i<j<k
+        std::unordered_map<size_t, size_t> edgeOccurrences;
+        std::unordered_map<size_t, size_t> strongEdgeOccurrences;
+        std::unordered_map<size_t, size_t> triangleOccurrences;
+
+        void setSize(size_t hypergraphSize);
+};
+
+// Loads the hypergraphs of the files concurrently, each thread counting in its own accumulator.
+AverageHypergraphAccumulator accumulateHypergraphFiles(const std::vector<std::string>& fileNames, bool edgeStrength, size_t threadNumber=0);
+
+} //namespace GRIT
+
+#endif
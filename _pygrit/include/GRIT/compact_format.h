@@ -0,0 +1,91 @@
+#ifndef GRIT_COMPACT_FORMAT_H
+#define GRIT_COMPACT_FORMAT_H
+
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "GRIT/hypergraph.h"
+
+
+namespace GRIT {
+
+// Single file hypergraph format
+//   - Header (CompactHypergraphHeader)
+//   - Edges (i, j, multiplicity) with i<j, lexicographically sorted
+//   - Triangles (i, j, k) with i<j<k, lexicographically sorted
+// Triplets are stored as 32 bits integers. When compressed, every triplet is
+// delta encoded with the previous one and written as variable length integers.
+
+const char COMPACT_HYPERGRAPH_MAGIC[8] = {'G', 'R', 'I', 'T', 'H', 'Y', 'P', '\0'};
+const uint32_t COMPACT_HYPERGRAPH_VERSION = 1;
+const uint32_t COMPACT_HYPERGRAPH_COMPRESSED = 1;
+
+struct CompactHypergraphHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint64_t size;
+    uint64_t edgeNumber;
+    uint64_t triangleNumber;
+    uint64_t edgeBytes;
+    uint64_t triangleBytes;
+    uint64_t checksum;  // of the bytes following the header
+};
+
+typedef std::array<uint32_t, 3> CompactTriplet;
+
+
+class MemoryMappedFile {
+    public:
+        explicit MemoryMappedFile(const std::string& fileName);
+        ~MemoryMappedFile();
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        const char* getData() const { return data; }
+        size_t getLength() const { return length; }
+
+    private:
+        const char* data = nullptr;
+        size_t length = 0;
+};
+
+
+class CompactHypergraphFile {
+    public:
+        explicit CompactHypergraphFile(const std::string& fileName);
+        CompactHypergraphFile(const CompactHypergraphFile&) = delete;
+        CompactHypergraphFile& operator=(const CompactHypergraphFile&) = delete;
+
+        size_t getSize() const { return header.size; }
+        size_t getEdgeNumber() const { return header.edgeNumber; }
+        size_t getTriangleNumber() const { return header.triangleNumber; }
+        bool isCompressed() const { return header.flags & COMPACT_HYPERGRAPH_COMPRESSED; }
+
+        // Point inside the mapped file unless the file is compressed
+        const uint32_t* getEdges() const { return edges; }
+        const uint32_t* getTriangles() const { return triangles; }
+
+        Hypergraph toHypergraph() const;
+
+        static bool isCompactHypergraph(const std::string& fileName);
+
+    private:
+        std::unique_ptr<MemoryMappedFile> file;
+        CompactHypergraphHeader header;
+        std::vector<uint32_t> decodedEdges, decodedTriangles;
+        const uint32_t* edges;
+        const uint32_t* triangles;
+};
+
+
+void writeCompactHypergraph(const std::string& fileName, size_t size,
+        std::vector<CompactTriplet> edges, std::vector<CompactTriplet> triangles, bool compress=false);
+
+} //namespace GRIT
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef GRIT_CONVERGENCE_DIAGNOSTICS_H
+#define GRIT_CONVERGENCE_DIAGNOSTICS_H
+
+
+#include <istream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "GRIT/utility.h"
+#include "GRIT/hypergraph.h"
+
+
+namespace GRIT {
+
+// Count, mean and sum of squared deviations of values, merged without loss of precision
+struct Moments {
+    size_t count = 0;
+    double mean = 0;
+    double squaredDeviations = 0;
+
+    void add(double value);
+    void merge(const Moments& other);
+    double getVariance() const { return count > 1 ? squaredDeviations/(count-1) : 0; }
+};
+
+// Batch means of a scalar series in constant memory. When BATCH_NUMBER batches are complete,
+// adjacent batches are merged and the batch size doubles. The diagnostics only use complete
+// batches and are undefined (NaN) until the first merge.
+class StreamingBatchMeans {
+    public:
+        static constexpr size_t BATCH_NUMBER = 64;
+
+        void push(double value);
+        bool hasEnoughSamples() const { return batchSize > 1; }
+        size_t getSampleNumber() const { return batches.size()*batchSize; }
+        size_t getBatchSize() const { return batchSize; }
+        Moments getMoments() const;
+
+        double getEffectiveSampleSize() const;
+        // Compares the first 10% and the last 50% of the batches
+        double getGewekeZScore() const;
+        // Moments of the first and last halves of the complete batches
+        std::pair<Moments, Moments> getSplitHalves() const;
+
+        void writeState(std::ostream&) const;
+        void readState(std::istream&);
+
+    private:
+        std::vector<Moments> batches;
+        Moments currentBatch;
+        size_t batchSize = 1;
+};
+
+// Split-R-hat of the chains that have enough samples, each chain being split in two halves
+double getSplitRHat(const std::vector<const StreamingBatchMeans*>& chains);
+
+
+// A target of 0 is ignored
+struct ConvergenceTargets {
+    double minimumEffectiveSampleSize = 0;
+    double maximumGewekeZScore = 0;
+    double maximumSplitRHat = 0;
+
+    bool any() const { return minimumEffectiveSampleSize > 0 || maximumGewekeZScore > 0 || maximumSplitRHat > 0; }
+};
+
+struct QuantityDiagnostics {
+    std::string name;
+    size_t sampleSize;
+    double mean;
+    double effectiveSampleSize;
+    double gewekeZScore;
+    double splitRHat;
+};
+
+// Diagnostics of the log-likelihood, the hyperedge counts and the parameters of the chains
+// sharing the monitor. The split-R-hat of a chain compares it with every other chain recorded.
+// Chains may record concurrently.
+class ConvergenceMonitor {
+    public:
+        explicit ConvergenceMonitor(const ConvergenceTargets& targets=ConvergenceTargets()): targets(targets) {}
+
+        void resetChain(size_t chain);
+        void record(size_t chain, double logLikelihood, const Hypergraph& hypergraph, const Parameters& parameters);
+
+        std::vector<QuantityDiagnostics> getDiagnostics(size_t chain) const;
+        // False when no target is set
+        bool hasConverged(size_t chain) const;
+        const ConvergenceTargets& getTargets() const { return targets; }
+
+        // Series of a chain, saved in checkpoints so that a resumed chain keeps its diagnostics
+        void writeChainState(size_t chain, std::ostream&) const;
+        void readChainState(size_t chain, std::istream&);
+
+    private:
+        const ConvergenceTargets targets;
+        std::map<size_t, std::vector<StreamingBatchMeans>> chainQuantities;
+        mutable std::mutex mutex;
+
+        std::vector<QuantityDiagnostics> computeDiagnostics(size_t chain) const;
+};
+
+} //namespace GRIT
+
+#endif
@@ -5,19 +5,40 @@
 #include <string>
 #include <functional>
 #include <map>
+#include <memory>
 
 #include "GRIT/utility.h"
 #include "GRIT/hypergraph.h"
+#include "GRIT/sample_writer.h"
+#include "GRIT/convergence_diagnostics.h"
+#include "GRIT/occupancy.h"
+#include "GRIT/proposers/proposer_base.h"
 
 
 namespace GRIT {
 
-typedef SparseMatrix<size_t> EdgeTypeFrequencies;
 struct RandomVariables {
     GRIT::Hypergraph hypergraph;
     GRIT::Parameters parameters;
 };
 
+// State of a chain after a Gibbs iteration. The hypergraph is never modified once
+// the sample is created, so sinks may keep it as long as they need.
+struct ChainSample {
+    size_t chain;
+    size_t iteration;
+    std::shared_ptr<const Hypergraph> hypergraph;
+    Parameters parameters;
+};
+// Receives every sample after the burn-in. Returning true stops the chain.
+typedef std::function<bool(const ChainSample&)> SampleSink;
+
+// Work done by a sampler since its creation, checkpointed iterations excluded
+struct SamplingStatistics {
+    size_t gibbsIterations = 0;
+    size_t metropolisHastingsSteps = 0;
+};
+
 
 class GibbsBase {
     public:
@@ -27,36 +48,92 @@ class GibbsBase {
         std::string parameterSampleDirectory = "./parametersample/";
 
         size_t chainID=0;
+        size_t sampleQueueCapacity=16;
+        SampleFormat sampleFormat=SampleFormat::SEPARATE_FILES;
+        SampleSink sampleSink;
+
+        // Every "checkpointInterval" Gibbs iterations, the state of the chain is saved to
+        // "checkpointFileName" so that resumeAndGetOccurences can continue it identically.
+        size_t checkpointInterval=0;
+        std::string checkpointFileName = "checkpoint.bin";
+        // The chain depends on the iteration order of the hypergraph and proposer containers. They are
+        // rebuilt in sorted order before every checkpoint, so a resumed chain continues identically.
+        // A positive "canonicalizationInterval" also rebuilds them every that many Gibbs iterations,
+        // which makes a chain with checkpoints identical to one without when both use the same value.
+        size_t canonicalizationInterval=0;
+
+        // Tunes the hypergraph moves during the burn-in and freezes them for the sampling
+        bool adaptiveMoves=false;
+
+        // Records the samples of the chain and stops it once the monitor's targets are met.
+        // The sample size is then an upper bound. The recorded samples are part of the checkpoints.
+        std::shared_ptr<ConvergenceMonitor> convergenceMonitor;
+
+        // Started at the end of the burn-in of sampleAndGetOccurences and resumeAndGetOccurences, and saved
+        // in the checkpoints. It must also be given to the hypergraph sampler, which records its steps.
+        OccupancyAccumulator* occupancyAccumulator = nullptr;
 
     public:
         explicit GibbsBase(Hypergraph& hypergraph, Parameters& parameters, size_t verbose=2): hypergraph(hypergraph), parameters(parameters), verbose(verbose) {};
-        virtual ~GibbsBase() {};
+        virtual ~GibbsBase();
 
         virtual void sampleFromPosterior() = 0;
         virtual void sampleHypergraphChain(size_t mhSteps, size_t points, const std::list<size_t>& iterations) = 0;
         virtual double getAverageLogLikelihood() = 0;
+        virtual double getCurrentLogLikelihood() const = 0;
         virtual void resetValues() = 0;
+        virtual SamplingStatistics getSamplingStatistics() const { return {}; }
+        virtual MoveParameters getMoveParameters() const { return {}; }
 
         void sample(size_t sampleSize, size_t burnin);
         RandomVariables sampleAndGetAverage(size_t sampleSize, size_t burnin, bool correlation=true, bool writeSamplesToFile=false);
         std::pair<EdgeTypeFrequencies, EdgeTypeFrequencies> sampleAndGetOccurences(size_t sampleSize, size_t burnin, bool correlation=true, bool writeSamplesToFile=false);
+        std::pair<EdgeTypeFrequencies, EdgeTypeFrequencies> resumeAndGetOccurences(size_t sampleSize, size_t burnin, bool correlation=true, bool writeSamplesToFile=false);
         template<typename T>
         std::vector<std::vector<T>> sampleCurrentChainWithMetrics(const std::list<std::function<T(const Hypergraph&, const Parameters&, const Observations&)>>& metrics,
                 const std::function<Observations(const Hypergraph&, const Parameters&)>& observationsGeneratingFunction, size_t sampleSize, size_t burnin, bool writeSamplesToFile=false);
 
         void setVerbose(size_t v) { verbose=v; }
-
-        void writeStateToFile(size_t iteration) const;
+        // Samples counted in the occurences returned by the last sampleAndGetOccurences or resumeAndGetOccurences.
+        // It is smaller than the sample size when the chain was stopped early.
+        size_t getOccurencesSampleNumber() const { return occurencesSampleNumber; }
+
+        void writeStateToFile(size_t iteration);
+        bool streamSample(size_t iteration) const;
+        bool monitorConvergence(size_t iteration) const;
+        void flushSamples();
         void writeGraphStateToBinary(size_t iteration) const;
         void writeParametersStateToBinary(size_t iteration) const;
 
+        void writeCheckpoint(size_t nextIteration, size_t sampleSize, size_t burnin,
+                const EdgeTypeFrequencies& edgetype1, const EdgeTypeFrequencies& edgetype2);
+        size_t readCheckpoint(size_t sampleSize, size_t burnin, EdgeTypeFrequencies& edgetype1, EdgeTypeFrequencies& edgetype2);
+
     protected:
         Hypergraph& hypergraph;
         Parameters& parameters;
         size_t verbose;
+        std::unique_ptr<AsyncSampleWriter> sampleWriter;
 
     protected:
         void outputProgressToConsole(size_t iteration, size_t sampleSize, size_t burnin) const;
+        void resetConvergenceMonitor() const;
+
+        // State of the derived sampler that isn't recomputed from the hypergraph and the parameters
+        virtual void writeSamplerState(std::ostream&) const {}
+        virtual void readSamplerState(std::istream&) {}
+        virtual void recomputeDistributions() {}
+        virtual void setMoveAdaptation(bool) {}
+        void updateMoveAdaptation(size_t iteration, size_t burnin);
+
+    private:
+        bool adaptingMoves=false;
+        size_t occurencesSampleNumber=0;
+
+        void continueAndGetOccurences(size_t firstIteration, size_t sampleSize, size_t burnin, bool correlation, bool writeSamplesToFile,
+                EdgeTypeFrequencies& edgetype1, EdgeTypeFrequencies& edgetype2);
+        void restoreHypergraph(size_t size, const std::vector<Index>& edges, const std::vector<Index>& triangles);
+        void canonicalizeState();
 
     public: // public for testing
         void updateTypesProportions(EdgeTypeFrequencies& edgetype1, EdgeTypeFrequencies& edgetype2, bool correlated) const;
@@ -73,9 +150,10 @@ std::vector<std::vector<T>> GibbsBase::sampleCurrentChainWithMetrics(const std::
     std::vector<std::vector<T>> values(functions.size());
 
     resetValues();
+    resetConvergenceMonitor();
     outputProgressToConsole(0, sampleSize, burnin);  // Display process started
     for (size_t i=0; i<sampleSize+burnin; i++) {
-
+        updateMoveAdaptation(i, burnin);
         sampleFromPosterior();
 
         if (i >= burnin) {
@@ -87,9 +165,12 @@ std::vector<std::vector<T>> GibbsBase::sampleCurrentChainWithMetrics(const std::
             }
             if (writeSamplesToFile)
                 writeStateToFile(i-burnin);
+            if (streamSample(i-burnin) || monitorConvergence(i-burnin))
+                break;
         }
         outputProgressToConsole(i+1, sampleSize, burnin);
     }
+    flushSamples();
     return values;
 }
 
@@ -22,6 +22,7 @@ class GibbsSampler: public GibbsBase {
     size_t chainLength = 0;
     double currentLogLikelihood = 0;
     double averageLogLikelihood = 0;
+    size_t performedIterations = 0;
 
     public:
         explicit GibbsSampler(Hypergraph&, Parameters&, T_parameterSampler&, T_hypergraphSampler&);
@@ -29,9 +30,18 @@ class GibbsSampler: public GibbsBase {
         //void executeBurninIteration() { sampleFromPosterior(); }
         void sampleFromPosterior();
         double getAverageLogLikelihood() { return averageLogLikelihood; }
+        double getCurrentLogLikelihood() const { return currentLogLikelihood; }
 
         void sampleHypergraphChain(size_t mhSteps, size_t points, const std::list<size_t>& iterations);
         void resetValues() { chainLength=0, averageLogLikelihood=0; currentLogLikelihood=0; hypergraphSampler.recomputeProposersDistributions(); }
+        SamplingStatistics getSamplingStatistics() const { return {performedIterations, hypergraphSampler.getStepNumber()}; }
+        MoveParameters getMoveParameters() const { return hypergraphSampler.getMoveParameters(); }
+
+    protected:
+        void writeSamplerState(std::ostream&) const;
+        void readSamplerState(std::istream&);
+        void recomputeDistributions() { hypergraphSampler.recomputeProposersDistributions(); }
+        void setMoveAdaptation(bool adapt) { hypergraphSampler.setMoveAdaptation(adapt); }
 
     private:
         void sampleParametersFromPosterior() { parameterSampler.sample(); }
@@ -53,12 +63,29 @@ template<typename T_parameterSampler, typename T_hypergraphSampler>
 void GibbsSampler<T_parameterSampler, T_hypergraphSampler>::sampleFromPosterior() {
     sampleHypergraphFromPosterior();
     sampleParametersFromPosterior();
+    performedIterations++;
 
     chainLength++;  // Has to be increased before the computation of the average
     currentLogLikelihood = hypergraphSampler.evaluateLogLikelihood();
     averageLogLikelihood += (currentLogLikelihood-averageLogLikelihood) / chainLength;
 }
 
+template<typename T_parameterSampler, typename T_hypergraphSampler>
+void GibbsSampler<T_parameterSampler, T_hypergraphSampler>::writeSamplerState(std::ostream& stream) const {
+    writeBinaryValue(stream, chainLength);
+    writeBinaryValue(stream, currentLogLikelihood);
+    writeBinaryValue(stream, averageLogLikelihood);
+    hypergraphSampler.writeState(stream);
+}
+
+template<typename T_parameterSampler, typename T_hypergraphSampler>
+void GibbsSampler<T_parameterSampler, T_hypergraphSampler>::readSamplerState(std::istream& stream) {
+    readBinaryValue(stream, chainLength);
+    readBinaryValue(stream, currentLogLikelihood);
+    readBinaryValue(stream, averageLogLikelihood);
+    hypergraphSampler.readState(stream);
+}
+
 template<typename T_parameterSampler, typename T_hypergraphSampler>
 void GibbsSampler<T_parameterSampler, T_hypergraphSampler>::sampleHypergraphChain(size_t mhSteps, size_t points, const std::list<size_t>& iterations) {
     resetValues();
@@ -16,9 +16,15 @@ class EdgeStrengthGraphModel {
     const size_t q1Index = 0;
     const size_t q2Index = 1;
 
+    // Log-likelihood differences between multiplicities m+1 and m, indexed by m
+    double addedEdgeLogRatios[2], removedEdgeLogRatios[2];
+
     public:
         EdgeStrengthGraphModel(const Hypergraph& hypergraph, const Parameters& parameters, const Observations& observations):
-            hypergraph(hypergraph), parameters(parameters) {}
+            hypergraph(hypergraph), parameters(parameters) { updateParameterCache(); }
+
+        // Must be called after the parameters are modified
+        void updateParameterCache();
 
         double operator()(const TwoStepsEdgeProposal& proposal) const;
         double getLoglikelihood() const;
@@ -15,9 +15,18 @@ class GilbertGraphModel {
     const Parameters& parameters;
     const size_t qIndex = 0;
 
+    double addedEdgeLogOdds, removedEdgeLogOdds;
+
     public:
         GilbertGraphModel(const Hypergraph& hypergraph, const Parameters& parameters, const Observations& observations):
-            hypergraph(hypergraph), parameters(parameters) {}
+            hypergraph(hypergraph), parameters(parameters) { updateParameterCache(); }
+
+        // Must be called after the parameters are modified
+        void updateParameterCache() {
+            const double& q = parameters[qIndex];
+            addedEdgeLogOdds = log(q) - log(1-q);
+            removedEdgeLogOdds = log(1-q) - log(q);
+        }
 
         double operator()(const TwoStepsEdgeProposal& proposal) const;
         double getLoglikelihood() const {
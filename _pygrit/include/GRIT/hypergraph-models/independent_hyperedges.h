@@ -16,9 +16,19 @@ class IndependentHyperedgesModel {
     const size_t pIndex = 0;
     const size_t qIndex = 1;
 
+    double triangleLogOdds, edgeLogOdds;
+
     public:
         IndependentHyperedgesModel(const Hypergraph& hypergraph, const Parameters& parameters, const Observations& observations):
-            hypergraph(hypergraph), parameters(parameters) {}
+            hypergraph(hypergraph), parameters(parameters) { updateParameterCache(); }
+
+        // Must be called after the parameters are modified
+        void updateParameterCache() {
+            const double& p = parameters[pIndex];
+            const double& q = parameters[qIndex];
+            triangleLogOdds = log(p) - log(1-p);
+            edgeLogOdds = log(q) - log(1-q);
+        }
 
         double operator()(const FourStepsHypergraphProposal& proposal) const;
         double operator()(const SixStepsHypergraphProposal& proposal) const;
@@ -26,6 +26,8 @@ class Hypergraph : public TriangleList {
 
         bool addEdge(c_Index& vertex1, c_Index& vertex2);
         bool addMultiedge(c_Index& vertex1, c_Index& vertex2, size_t n);
+        template<typename T>  // Fast path for loaders. (i, j, multiplicity) with i<j must be sorted and the hypergraph without edges.
+        void addSortedEdges(const T* edgeTriplets, size_t tripletNumber);
         bool removeEdge(c_Index& vertex1, c_Index& vertex2);
         bool isEdge(c_Index& vertex1, c_Index& vertex2) const { return getEdgeMultiplicity(vertex1, vertex2) > 0; }
         size_t getEdgeMultiplicity(c_Index& vertex1, c_Index& vertex2) const;
@@ -33,17 +35,24 @@ class Hypergraph : public TriangleList {
         size_t getHighestOrderHyperedgeWith(c_Index& vertex1, c_Index& vertex2) const;
         size_t getHighestOrderHyperedgeExcluding(c_Index& vertex1, c_Index& vertex2, const Triplet& excludedTriplet) const;
         size_t getHighestOrderHyperedgeExcluding(c_Index& vertex1, c_Index& vertex2, const Edge& exludedEdge) const;
+        // Highest order hyperedges of the pairs (i, j), (i, k) and (j, k) of an ordered triplet
+        std::array<size_t, 3> getTripletPairsHighestOrder(const Triplet& orderedTriplet, bool excludeTriplet) const;
 
         const AdjacentEdges& getEdgesFrom(c_Index& vertex) const { return adjacencyLists[vertex]; }
+        // (j, type) of the pairs (vertex, j), j>vertex, of non-zero type by increasing j. The type is
+        // the highest order hyperedge when "highestOrder" is true and the edge multiplicity otherwise.
+        std::vector<std::pair<Index, size_t>> getHigherNeighbourTypes(c_Index& vertex, bool highestOrder) const;
         const std::list<Triplet> getFullTriangleList() const;
 
         void writeToBinary(const std::string& fileName) const;
         void writeTrianglesToBinary(const std::string& fileName) const { TriangleList::writeToBinary(fileName); };
         void writeEdgesToBinary(const std::string& fileName) const;
 
+        void writeToCompactBinary(const std::string& fileName, bool compress=false) const;
         void writeToCSV(const std::string& fileName) const;
 
         static Hypergraph loadFromBinary(const std::string& filePrefix);
+        static Hypergraph loadFromCompactBinary(const std::string& fileName);
 
     private:
         size_t edgeNumber;
@@ -51,6 +60,26 @@ class Hypergraph : public TriangleList {
 
 };
 
+template<typename T>
+void Hypergraph::addSortedEdges(const T* edgeTriplets, size_t tripletNumber) {
+    if (edgeNumber != 0)
+        throw std::logic_error("Edges can only be bulk added to a hypergraph without edges.");
+
+    for (size_t n=0; n<tripletNumber; n++) {
+        const T* edge = edgeTriplets+3*n;
+        if (edge[0] >= edge[1] || edge[1] >= size || edge[2] == 0)
+            throw std::logic_error("Bulk adding edges: edge is not ordered, out of range or empty.");
+        if (n > 0 && !std::lexicographical_compare(edge-3, edge-1, edge, edge+2))
+            throw std::logic_error("Bulk adding edges: edges are not sorted or contain duplicates.");
+    }
+    for (size_t n=0; n<tripletNumber; n++) {
+        const T* edge = edgeTriplets+3*n;
+        adjacencyLists[edge[0]].push_back({edge[1], edge[2]});
+        adjacencyLists[edge[1]].push_back({edge[0], edge[2]});
+    }
+    edgeNumber = tripletNumber;
+}
+
 } //namespace GRIT
 
 #endif
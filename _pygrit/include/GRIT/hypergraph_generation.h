@@ -0,0 +1,43 @@
+#ifndef GRIT_HYPERGRAPH_GENERATION_H
+#define GRIT_HYPERGRAPH_GENERATION_H
+
+
+#include <vector>
+
+#include "GRIT/utility.h"
+#include "GRIT/hypergraph.h"
+
+
+namespace GRIT {
+
+// Random hypergraphs drawn from GRIT::generator. The generators taking a number of threads
+// only draw a seed from GRIT::generator, so their hypergraph doesn't depend on the number of threads.
+
+Hypergraph generateIndependentTriangleHypergraph(size_t n, double p);
+Hypergraph generateIndependentHyperedgesHypergraph(size_t n, double p, double q);
+Hypergraph generateIndependentLayeredEdges(size_t n, double q1, double q2);
+Hypergraph generateIndependentHyperedgeOnlyCycles(size_t size, size_t subgraphSize, double triangleProbability);
+Hypergraph generateIndependentHyperedgeWithoutCycles(size_t n, double triangleProbability, double edgeProbability);
+
+// The edges {i, j} and the triangles {i, j, k} have probabilities logistic(a_i+a_j) and logistic(b_i+b_j+b_k),
+// where a and b are the edge and triangle propensities. generateBetaModelHypergraph visits every pair and
+// triplet in O(n^3). The skipping generator draws the same distribution in a time proportional to the
+// number of hyperedges.
+Hypergraph generateBetaModelHypergraph(const std::vector<double>& edgePropensities, const std::vector<double>& trianglePropensities);
+Hypergraph generateBetaModelHypergraphBySkipping(const std::vector<double>& edgePropensities, const std::vector<double>& trianglePropensities, size_t threadNumber=0);
+// Normally distributed propensities
+Hypergraph generateBetaModelHypergraphWithNormalDistributions(size_t n, double edgeMean, double edgeSTD, double triangleMean, double triangleSTD);
+Hypergraph generateBetaModelHypergraphBySkipping(size_t n, double edgeMean, double edgeSTD, double triangleMean, double triangleSTD, size_t threadNumber=0);
+
+Hypergraph generateMillerConfigurationModelHypergraphWithGeometricDistribution(size_t n, double edgeProbability, double triangleProbability);
+
+// Vertices are numbered by community. Hyperedges within a community have its intra community
+// probability and hyperedges spanning several communities the inter community probability.
+Hypergraph generateSBMHypergraph(const std::vector<double>& communitySizes,
+        const std::vector<double>& intraCommunityEdgeProbabilities, double interCommunityEdgeProbability,
+        const std::vector<double>& intraCommunityTriangleProbabilities, double interCommunityTriangleProbability,
+        size_t threadNumber=0);
+
+} //namespace GRIT
+
+#endif
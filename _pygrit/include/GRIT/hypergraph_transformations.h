@@ -0,0 +1,22 @@
+#ifndef GRIT_HYPERGRAPH_TRANSFORMATIONS_H
+#define GRIT_HYPERGRAPH_TRANSFORMATIONS_H
+
+
+#include "GRIT/hypergraph.h"
+
+
+namespace GRIT {
+
+// The transformations only visit the existing edges and triangles and build their result with the
+// bulk loaders, so their cost is linear in the number of hyperedges.
+
+// Hypergraph without the vertices that have no edge and no triangle. The other vertices keep their order.
+Hypergraph removeDisconnectedVertices(const Hypergraph& hypergraph);
+// Graph of the pairs contained in an edge or a triangle
+Hypergraph projectHypergraphOnGraph(const Hypergraph& hypergraph);
+// Multigraph whose edge multiplicities are the highest order hyperedges of the pairs
+Hypergraph projectHypergraphOnMultigraph(const Hypergraph& hypergraph);
+
+} //namespace GRIT
+
+#endif
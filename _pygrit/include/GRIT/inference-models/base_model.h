@@ -1,8 +1,15 @@
 #ifndef GRIT_BASE_MODEL_H
 #define GRIT_BASE_MODEL_H
 
+#include <stdexcept>
+
 #include "GRIT/utility.h"
 #include "GRIT/hypergraph.h"
+#include "GRIT/sample_writer.h"
+#include "GRIT/gibbs_base.h"
+#include "GRIT/convergence_diagnostics.h"
+#include "GRIT/occupancy.h"
+#include "GRIT/move_statistics.h"
 
 
 class InferenceModel {
@@ -18,15 +25,87 @@ class InferenceModel {
                 throw err;
             }
         }
+        // Continues "sample" from the last checkpoint written in the output directory
+        double resume(size_t sampleSize, size_t burnin, size_t chain,
+                    GRIT::Hypergraph& hypergraph, GRIT::Parameters& parameters, const GRIT::Observations& observations, const std::string& outputDirectory) const {
+            return execute("resume", sampleSize, burnin, chain, 0, {}, hypergraph, parameters, observations, outputDirectory);
+        }
         double sampleHypergraphs(size_t mhSteps, size_t points, const std::list<size_t>& iterations,
                     GRIT::Hypergraph& hypergraph, GRIT::Parameters& parameters, const GRIT::Observations& observations, const std::string& outputDirectory) const {
             return execute("sample_hypergraphs", mhSteps, 0, 0, points, iterations, hypergraph, parameters, observations, outputDirectory);
         }
 
+        void setSampleFormat(const std::string& format) {
+            if (format == "separate files")
+                sampleFormat = GRIT::SampleFormat::SEPARATE_FILES;
+            else if (format == "compact")
+                sampleFormat = GRIT::SampleFormat::COMPACT;
+            else if (format == "compressed")
+                sampleFormat = GRIT::SampleFormat::COMPRESSED;
+            else
+                throw std::logic_error("Unknown sample format \""+format+"\". Expected \"separate files\", \"compact\" or \"compressed\".");
+        }
+
+        // The sink receives the samples of "sample" while the chain runs. Writing the samples
+        // to the output directory can be disabled when they are only consumed by the sink.
+        void setSampleSink(const GRIT::SampleSink& sink) { sampleSink = sink; }
+        void setWriteSamples(bool write) { writeSamples = write; }
+        bool getWriteSamples() const { return writeSamples; }
+        // See GibbsBase for the canonicalization of the chain state
+        void setCheckpointInterval(size_t interval) { checkpointInterval = interval; }
+        void setCanonicalizationInterval(size_t interval) { canonicalizationInterval = interval; }
+        // Tunes the move probabilities and eta during the burn-in of "sample"
+        void setAdaptiveMoves(bool adaptive) { adaptiveMoves = adaptive; }
+        // Records the edge types of the pairs at every Metropolis-Hastings step after the burn-in of "sample".
+        // The fractions of steps spent in types 1 and 2 are written next to the occurences.
+        void setOccupancyAccumulation(bool accumulate) { accumulateOccupancy = accumulate; }
+        // Every chain of "sample" is then stopped once its diagnostics meet the targets. The chains sampled
+        // until the next call are compared by the split-R-hat.
+        void setConvergenceTargets(const GRIT::ConvergenceTargets& targets) { convergenceMonitor = std::make_shared<GRIT::ConvergenceMonitor>(targets); }
+        // Diagnostics of the samples after the burn-in of the last "sample" or "resume" of the chain
+        std::vector<GRIT::QuantityDiagnostics> getConvergenceDiagnostics(size_t chain) const { return convergenceMonitor->getDiagnostics(chain); }
+
+        // Statistics of the last call to sample, resume or sampleHypergraphs
+        GRIT::SamplingStatistics getSamplingStatistics() const { return samplingStatistics; }
+        // Empty unless compiled with GRIT_MOVE_STATISTICS. Also written next to the samples.
+        const GRIT::MoveStatistics& getMoveStatistics() const { return moveStatistics; }
+        // Move probabilities and eta at the end of the last call, after adaptation
+        const GRIT::MoveParameters& getMoveParameters() const { return moveParameters; }
+        static bool isCollectingMoveStatistics() { return GRIT::MoveStatisticsCollector::enabled; }
+
+        static std::string getCheckpointFileName(const std::string& outputDirectory, size_t chain) {
+            return outputDirectory+"checkpoint"+std::to_string(chain)+".bin";
+        }
+        static std::string getOccupancyFileName(const std::string& outputDirectory, size_t chain, size_t edgeType) {
+            return outputDirectory+"occupancy"+std::to_string(chain)+"_edgetype"+std::to_string(edgeType)+".bin";
+        }
+        static std::string getMoveStatisticsFileName(const std::string& outputDirectory, size_t chain) {
+            return outputDirectory+"movestatistics"+std::to_string(chain)+".json";
+        }
+
         virtual double getLogLikelihood(const GRIT::Hypergraph& hypergraph, const GRIT::Parameters& parameters, const GRIT::Observations& observations) const = 0;
         virtual std::list<double> getPairwiseObservationsProbabilities(const GRIT::Hypergraph& hypergraph, const GRIT::Parameters& parameters, const GRIT::Observations& observations) const = 0;
         virtual GRIT::Observations generateObservations(const GRIT::Hypergraph&, const GRIT::Parameters&) const = 0;
 
+    protected:
+        GRIT::SampleFormat sampleFormat = GRIT::SampleFormat::SEPARATE_FILES;
+        GRIT::SampleSink sampleSink;
+        bool writeSamples = true;
+        size_t checkpointInterval = 0;
+        size_t canonicalizationInterval = 0;
+        bool adaptiveMoves = false;
+        bool accumulateOccupancy = false;
+        std::shared_ptr<GRIT::ConvergenceMonitor> convergenceMonitor = std::make_shared<GRIT::ConvergenceMonitor>();
+        mutable GRIT::SamplingStatistics samplingStatistics;
+        mutable GRIT::MoveStatistics moveStatistics;
+        mutable GRIT::MoveParameters moveParameters;
+
+        void writeOccupancyFractions(const GRIT::OccupancyAccumulator& accumulator, const std::string& outputDirectory, size_t chain) const {
+            auto fractions = accumulator.getPairOccupancyFractions();
+            GRIT::writeSparseMatrixToBinary<double>(fractions.first,  getOccupancyFileName(outputDirectory, chain, 1));
+            GRIT::writeSparseMatrixToBinary<double>(fractions.second, getOccupancyFileName(outputDirectory, chain, 2));
+        }
+
     private:
         virtual double execute(const std::string& what, size_t sampleSize, size_t burnin, size_t chain, size_t points, const std::list<size_t>& iterations,
                     GRIT::Hypergraph&, GRIT::Parameters&, const GRIT::Observations&,
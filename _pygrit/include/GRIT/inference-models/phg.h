@@ -14,6 +14,7 @@
 #include "GRIT/proposers/sixsteps_hypergraph.h"
 #include "GRIT/proposers/edge-choosers/uniform_edge_chooser.h"
 #include "GRIT/proposers/edge-choosers/weighted_unique_chooser.h"
+#include "GRIT/proposers/edge-choosers/weighted_pair_chooser.h"
 #include "GRIT/proposers/triangle-choosers/observations_by_pairs_chooser.h"
 #include "GRIT/proposers/triangle-choosers/uniform_triangle_chooser.h"
 
@@ -23,6 +24,7 @@
 class PHG: public InferenceModel {
     typedef GRIT::ObservationsWeightedUniqueEdgeChooser EdgeAdder;
     typedef GRIT::UniformNonEdgeChooser                 EdgeRemover;
+    typedef GRIT::ObservationsWeightedPairChooser       PairChooser;
     typedef GRIT::ObservationsPairwiseTriangleChooser   TriangleAdder;
     typedef GRIT::UniformTriangleChooser                TriangleRemover;
 
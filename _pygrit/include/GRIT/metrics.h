@@ -0,0 +1,44 @@
+#ifndef GRIT_METRICS_H
+#define GRIT_METRICS_H
+
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "GRIT/hypergraph.h"
+
+
+namespace GRIT {
+
+// Number of pairs of type 1 that belong to a triangle of pairs of non-zero types. "edgeTypes" is a
+// row-major n x n array of which only the upper triangle is read. Triangles are enumerated by
+// intersecting the sorted neighbour lists of the vertices ordered by degree, in parallel over vertices.
+size_t countEdgesInTriangles(const size_t* edgeTypes, size_t n, size_t threadNumber=0);
+
+struct ResidualsOfTypes {
+    std::array<double, 3> sums = {0, 0, 0};
+    std::array<double, 3> absoluteSums = {0, 0, 0};
+};
+
+// Sums of the residuals observations-replicate and of their absolute values over the pairs of each
+// type (0, 1 or 2), for each of the "replicateNumber" consecutive replicates. Every array holds one
+// value per pair. The replicates are split in chunks of pairs reduced in parallel.
+std::vector<ResidualsOfTypes> getResidualsOfTypes(const int8_t* edgeTypes, const uint32_t* observations,
+        const uint32_t* replicates, size_t replicateNumber, size_t pairNumber, size_t threadNumber=0);
+
+// Number of pairs whose edge multiplicity (edge distance) or highest order hyperedge (global
+// distance) differ. The sorted types of the pairs (i, j), j>i, of both hypergraphs are merged for
+// each vertex i, so the cost is linear in the number of edges and triangles.
+size_t getEdgeHammingDistance(const Hypergraph& hypergraph1, const Hypergraph& hypergraph2);
+size_t getGlobalHammingDistance(const Hypergraph& hypergraph1, const Hypergraph& hypergraph2);
+// Distances from "reference" to the hypergraphs of the binary files, such as the samples of a
+// chain. The pair types of the reference are computed once and the files are loaded in parallel.
+std::vector<size_t> getHammingDistancesToFiles(const Hypergraph& reference, const std::vector<std::string>& fileNames,
+        bool global, size_t threadNumber=0);
+
+} //namespace GRIT
+
+#endif
@@ -7,6 +7,8 @@
 
 #include "GRIT/utility.h"
 #include "GRIT/hypergraph.h"
+#include "GRIT/move_statistics.h"
+#include "GRIT/occupancy.h"
 #include "GRIT/proposers/proposer_base.h"
 
 
@@ -16,13 +18,14 @@ template<typename Proposer, typename ObservationsModel, typename HypergraphModel
 class MetropolisHastings {
 
     Proposer& proposer;
-    const ObservationsModel observationsModel;
-    const HypergraphModel hypergraphModel;
+    ObservationsModel observationsModel;
+    HypergraphModel hypergraphModel;
     const Prior modelPriors;
 
     const size_t minIterations = 0;
     const size_t maxIterations = 50000;
     size_t chainLength = 0;
+    size_t stepNumber = 0;
     size_t windowSize = 20000;
     double tolerance = 1e-3;
 
@@ -31,6 +34,10 @@ class MetropolisHastings {
     double currentLogLikelihood = 0;
     double averageLogLikelihood = 0;
 
+    MoveStatisticsCollector moveStatistics;
+    bool adaptingMoves = false;
+    OccupancyAccumulator* occupancyAccumulator = nullptr;
+
     public:
         MetropolisHastings(Hypergraph& hypergraph, const Observations& observations, const Parameters& parameters, const Parameters& hyperparameters, Proposer& proposer,
                                 const std::array<size_t, 2>& steps, size_t windowSize=20000, double tolerance=1e-3);
@@ -38,9 +45,19 @@ class MetropolisHastings {
         void advanceOneStep();
         double getCurrentLoglikelihood() const { return currentLogLikelihood; }
         double getAverageLoglikelihood() const { return averageLogLikelihood; }
+        size_t getStepNumber() const { return stepNumber; }
+        const MoveStatistics& getMoveStatistics() const { return moveStatistics.getStatistics(); }
         double evaluateLogLikelihood() const;
 
+        // Tunes the proposer moves while enabled. Must be disabled before sampling.
+        void setMoveAdaptation(bool adapt) { adaptingMoves = adapt; proposer.setAdaptation(adapt); }
+        MoveParameters getMoveParameters() const { return proposer.getMoveParameters(); }
+        // Every step is recorded by the accumulator once it is started
+        void setOccupancyAccumulator(OccupancyAccumulator* accumulator) { occupancyAccumulator = accumulator; }
+
         void resetValues();
+        void writeState(std::ostream&) const;
+        void readState(std::istream&);
         void recomputeProposersDistributions() { proposer.recomputeProposersDistributions(); }
 
         void processIteration(size_t iteration) {
@@ -80,9 +97,33 @@ void MetropolisHastings<Proposer, T_observations, HypergraphModel, Prior>::reset
     chainLength = 0;
     likelihoodAdjustment = 0;
     averageLogLikelihood = 0;
+    // The parameters are only sampled between hypergraph chains
+    observationsModel.updateParameterCache();
+    hypergraphModel.updateParameterCache();
     currentLogLikelihood = evaluateLogLikelihood();
 }
 
+// The convergence criterion of a Gibbs step uses the last window average of the previous step
+template<typename Proposer, typename T_observations, typename HypergraphModel, typename Prior>
+void MetropolisHastings<Proposer, T_observations, HypergraphModel, Prior>::writeState(std::ostream& stream) const {
+    writeBinaryValue(stream, chainLength);
+    writeBinaryValue(stream, likelihoodAdjustment);
+    writeBinaryValue(stream, previousLogLikelihoodAverage);
+    writeBinaryValue(stream, currentLogLikelihood);
+    writeBinaryValue(stream, averageLogLikelihood);
+    proposer.writeState(stream);
+}
+
+template<typename Proposer, typename T_observations, typename HypergraphModel, typename Prior>
+void MetropolisHastings<Proposer, T_observations, HypergraphModel, Prior>::readState(std::istream& stream) {
+    readBinaryValue(stream, chainLength);
+    readBinaryValue(stream, likelihoodAdjustment);
+    readBinaryValue(stream, previousLogLikelihoodAverage);
+    readBinaryValue(stream, currentLogLikelihood);
+    readBinaryValue(stream, averageLogLikelihood);
+    proposer.readState(stream);
+}
+
 template<typename Proposer, typename T_observations, typename HypergraphModel, typename Prior>
 double MetropolisHastings<Proposer, T_observations, HypergraphModel, Prior>::evaluateLogLikelihood() const {
     double logLikelihood = 0;
@@ -122,16 +163,27 @@ void MetropolisHastings<Proposer, T_observations, HypergraphModel, Prior>::sampl
 
 template<typename Proposer, typename T_observations, typename HypergraphModel, typename Prior>
 void MetropolisHastings<Proposer, T_observations, HypergraphModel, Prior>::advanceOneStep() {
+    moveStatistics.startStep();
     proposer.generateProposal();
+    moveStatistics.endPhase(MoveStatistics::PROPOSAL);
 
-    bool accept = acceptStep(getLogAcceptanceProbability());
+    double logAcceptance = getLogAcceptanceProbability();
+    bool accept = acceptStep(logAcceptance);
+    bool hypergraphChanged = false;
 
     if (accept) {
-        bool hypergraphChanged = proposer.applyStep();
+        hypergraphChanged = proposer.applyStep();
         if (hypergraphChanged)
             currentLogLikelihood += likelihoodAdjustment;
     }
-
+    moveStatistics.endPhase(MoveStatistics::APPLY);
+    moveStatistics.endStep(getMoveTypeIndex(proposer.currentProposal), proposer.currentProposal.move, accept, hypergraphChanged);
+    if (adaptingMoves)
+        proposer.adaptToStep(logAcceptance, hypergraphChanged);
+    if (occupancyAccumulator)
+        occupancyAccumulator->recordStep(proposer.currentProposal, hypergraphChanged);
+
+    stepNumber++;
     chainLength++;  // Must be increased before the correction of the average
     averageLogLikelihood += (currentLogLikelihood-averageLogLikelihood) / chainLength;
 }
@@ -156,10 +208,12 @@ double MetropolisHastings<Proposer, T_observations, HypergraphModel, Prior>::get
         throw std::runtime_error("MetropolisHastings: Hypergraph model probability ratio is NaN.");
 
     likelihoodAdjustment = logAcceptance;
+    moveStatistics.endPhase(MoveStatistics::MODEL_DELTAS);
 
     logAcceptance += proposer.getLogAcceptanceContribution();
     if (std::isnan(logAcceptance))
         throw std::runtime_error("MetropolisHastings: Proposal probability ratio is NaN.");
+    moveStatistics.endPhase(MoveStatistics::PROPOSER_RATIO);
 
     return logAcceptance;
 }
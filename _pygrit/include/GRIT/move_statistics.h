@@ -0,0 +1,108 @@
+#ifndef GRIT_MOVE_STATISTICS_H
+#define GRIT_MOVE_STATISTICS_H
+
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "GRIT/proposers/movetypes.h"
+
+
+namespace GRIT {
+
+
+// Counts and durations of the Metropolis-Hastings steps for every (move type, ADD/REMOVE).
+// Move types are the ones of SixStepsHypergraphProposal; edge proposers only make EDGE moves.
+struct MoveStatistics {
+    static const size_t MOVE_TYPE_NUMBER = 6;
+    enum Phase { PROPOSAL=0, MODEL_DELTAS, PROPOSER_RATIO, APPLY, PHASE_NUMBER };
+
+    struct Counters {
+        size_t proposed = 0;
+        size_t accepted = 0;
+        size_t unchanged = 0;  // Accepted, but applying the move left the hypergraph as is
+        std::array<uint64_t, PHASE_NUMBER> time {};
+    };
+
+    std::array<std::array<Counters, 2>, MOVE_TYPE_NUMBER> counters;
+
+    const Counters& get(size_t moveType, AddRemoveMove move) const { return counters[moveType][move]; }
+
+    static const char* getMoveTypeName(size_t moveType);
+    static const char* getPhaseName(size_t phase);
+    static const char* getTimeUnit();
+};
+
+// JSON object with an entry per move that was proposed at least once
+void writeMoveStatisticsToJson(const MoveStatistics& statistics, const std::string& fileName);
+
+
+inline size_t getMoveTypeIndex(const SixStepsHypergraphProposal& proposal) { return proposal.moveType; }
+inline size_t getMoveTypeIndex(const TwoStepsEdgeProposal&) { return SixStepsHypergraphProposal::EDGE; }
+
+// CPU cycles on x86, nanoseconds elsewhere
+inline uint64_t readCycleCounter() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+
+// Collects MoveStatistics when GRIT_MOVE_STATISTICS is defined and compiles to nothing otherwise.
+// Phases are timed from the previous call to startStep or endPhase.
+#ifdef GRIT_MOVE_STATISTICS
+class MoveStatisticsCollector {
+    MoveStatistics statistics;
+    std::array<uint64_t, MoveStatistics::PHASE_NUMBER> stepTime;
+    uint64_t lastTime = 0;
+
+    public:
+        static const bool enabled = true;
+
+        void startStep() {
+            stepTime.fill(0);
+            lastTime = readCycleCounter();
+        }
+        void endPhase(MoveStatistics::Phase phase) {
+            uint64_t time = readCycleCounter();
+            stepTime[phase] += time-lastTime;
+            lastTime = time;
+        }
+        void endStep(size_t moveType, AddRemoveMove move, bool accepted, bool changed) {
+            auto& counters = statistics.counters[moveType][move];
+            counters.proposed++;
+            if (accepted) {
+                counters.accepted++;
+                if (!changed)
+                    counters.unchanged++;
+            }
+            for (size_t phase=0; phase<MoveStatistics::PHASE_NUMBER; phase++)
+                counters.time[phase] += stepTime[phase];
+        }
+        const MoveStatistics& getStatistics() const { return statistics; }
+};
+#else
+class MoveStatisticsCollector {
+    MoveStatistics statistics;
+
+    public:
+        static const bool enabled = false;
+
+        void startStep() {}
+        void endPhase(MoveStatistics::Phase) {}
+        void endStep(size_t, AddRemoveMove, bool, bool) {}
+        const MoveStatistics& getStatistics() const { return statistics; }
+};
+#endif
+
+} //namespace GRIT
+
+#endif
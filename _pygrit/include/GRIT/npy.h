@@ -0,0 +1,21 @@
+#ifndef GRIT_NPY_H
+#define GRIT_NPY_H
+
+
+#include <string>
+
+#include "GRIT/utility.h"
+
+
+namespace GRIT {
+
+
+// Loads a square observations matrix saved with numpy.save (format versions 1 to 3).
+// Integer, boolean and floating point little-endian arrays are accepted as long as
+// their values are non-negative integers. As in the Python loader, the diagonal is
+// set to 0 and the matrix must be symmetric.
+Observations loadObservationsFromNpy(const std::string& fileName);
+
+} //namespace GRIT
+
+#endif
@@ -2,6 +2,7 @@
 #define GRIT_EDGETYPES_DATAMODEL_H
 
 
+#include <array>
 #include <stdexcept>
 
 #include "GRIT/utility.h"
@@ -17,9 +18,14 @@ class PoissonEdgeStrengthObservationsModel {
     const Parameters& parameters;
     const size_t mu0Index = 2;
 
+    std::array<double, 3> mu, logMu;
+
     public:
         PoissonEdgeStrengthObservationsModel(const Hypergraph& hypergraph, const Parameters& parameters, const Observations& observations):
-            observations(observations), hypergraph(hypergraph), parameters(parameters) {}
+            observations(observations), hypergraph(hypergraph), parameters(parameters) { updateParameterCache(); }
+
+        // Must be called after the parameters are modified
+        void updateParameterCache();
 
         double operator()(const TwoStepsEdgeProposal& proposal) const;
 
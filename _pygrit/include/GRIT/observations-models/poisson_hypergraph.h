@@ -2,6 +2,7 @@
 #define GRIT_HYPERGRAPH_POISSON_DATAMODEL_H
 
 
+#include <array>
 #include <stdexcept>
 
 #include "GRIT/utility.h"
@@ -17,9 +18,14 @@ class PoissonHypergraphObservationsModel {
     const Parameters& parameters;
     const size_t mu0Index = 2;
 
+    std::array<double, 3> mu, logMu;
+
     public:
         PoissonHypergraphObservationsModel(const Hypergraph& hypergraph, const Parameters& parameters, const Observations& observations):
-            observations(observations), hypergraph(hypergraph), parameters(parameters) {}
+            observations(observations), hypergraph(hypergraph), parameters(parameters) { updateParameterCache(); }
+
+        // Must be called after the parameters are modified
+        void updateParameterCache();
 
         double operator()(const FourStepsHypergraphProposal& proposal) const;
         double operator()(const SixStepsHypergraphProposal& proposal) const;
@@ -28,6 +34,7 @@ class PoissonHypergraphObservationsModel {
     private:
         double getTriangleContribution(const Triplet& triplet, const AddRemoveMove& move) const;
         double getEdgeContribution(c_Index& i, c_Index& j, const AddRemoveMove& move) const;
+        double getTriangleShiftContribution(const Triplet& triplet, const Triplet& shiftedTriplet) const;
 };
 
 } //namespace GRIT
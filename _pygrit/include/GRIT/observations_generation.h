@@ -0,0 +1,61 @@
+#ifndef GRIT_OBSERVATIONS_GENERATION_H
+#define GRIT_OBSERVATIONS_GENERATION_H
+
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "GRIT/utility.h"
+#include "GRIT/hypergraph.h"
+#include "GRIT/parallel.h"
+
+
+namespace GRIT {
+
+// Poisson observations of the pairs of a hypergraph, the mean of a pair being means[type]. The type
+// of a pair is the highest order hyperedge that contains it when "withTriangles" is true and its edge
+// multiplicity otherwise, capped to the last mean.
+//
+// Pairs of type 0 are reached by geometric skips to the next non-zero count and the other pairs are
+// found in the edges and triangles of each vertex, so the cost is proportional to the number of
+// hyperedges and non-zero counts. Rows are drawn in parallel by blocks of ROWS_PER_STREAM, each block
+// using the stream of its index, so the observations don't depend on the number of threads.
+class PoissonObservationsGenerator {
+    public:
+        static constexpr size_t ROWS_PER_STREAM = 64;
+
+        PoissonObservationsGenerator(const Hypergraph& hypergraph, const std::vector<double>& means, bool withTriangles);
+
+        // Non-zero counts of the pairs (i, j), j>i, by increasing j
+        std::vector<std::pair<Index, size_t>> drawRow(Index i, std::mt19937& rowGenerator) const;
+        size_t getStreamNumber() const { return (hypergraph.getSize()+ROWS_PER_STREAM-1)/ROWS_PER_STREAM; }
+
+        // Upper triangle (i<j) of the non-zero counts
+        SparseMatrix<size_t> generateSparse(size_t threadNumber=0) const;
+        Observations generate(size_t threadNumber=0) const;
+
+        // Pairs (i, j), i<j, in row-major order of the upper triangle
+        size_t getPairNumber() const { return nchoose2(hypergraph.getSize()); }
+        static size_t getPairIndex(size_t n, Index i, Index j) { return i*n - i*(i+1)/2 + j-i-1; }
+        // Fills the replicateNumber x getPairNumber() array "counts" with independent replicates.
+        // Replicate r of row block b uses the stream r*getStreamNumber()+b.
+        void generateBatch(size_t replicateNumber, uint32_t* counts, size_t threadNumber=0) const;
+
+    private:
+        const Hypergraph& hypergraph;
+        const std::vector<double> means;
+        const bool withTriangles;
+        double backgroundProbability;  // Probability of a non-zero count for a pair of type 0
+
+        std::vector<std::pair<Index, size_t>> getRowTypes(Index i) const;
+        size_t drawNonZeroBackground(std::mt19937& rowGenerator) const;
+        void drawRowBlock(size_t block, std::mt19937& blockGenerator,
+                const std::function<void(Index, std::vector<std::pair<Index, size_t>>&&)>& storeRow) const;
+};
+
+} //namespace GRIT
+
+#endif
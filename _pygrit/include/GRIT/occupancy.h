@@ -0,0 +1,75 @@
+#ifndef GRIT_OCCUPANCY_H
+#define GRIT_OCCUPANCY_H
+
+
+#include <istream>
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "GRIT/utility.h"
+#include "GRIT/hypergraph.h"
+#include "GRIT/proposers/movetypes.h"
+
+
+namespace GRIT {
+
+typedef SparseMatrix<size_t> EdgeTypeFrequencies;
+
+// Number of Metropolis-Hastings steps spent by each pair in each edge type and by each triangle
+// since "start". The state of a pair is its highest order hyperedge when "correlation" is true
+// and its edge multiplicity otherwise, types above 2 being counted as type 2 as in GibbsBase.
+// Each state keeps the step at which it was entered so that accepted moves are recorded in O(1).
+class OccupancyAccumulator {
+    public:
+        OccupancyAccumulator(const Hypergraph& hypergraph, bool correlation): hypergraph(hypergraph), correlation(correlation) {}
+
+        // Clears the occupancies. Steps are recorded until the next start.
+        void start();
+        bool isRecording() const { return recording; }
+
+        void recordStep(const SixStepsHypergraphProposal& proposal, bool hypergraphChanged);
+        void recordStep(const TwoStepsEdgeProposal& proposal, bool hypergraphChanged);
+
+        size_t getStepNumber() const { return stepNumber; }
+        // Steps spent in edge types 1 and 2. Type 0 is deduced from the step number.
+        std::pair<EdgeTypeFrequencies, EdgeTypeFrequencies> getPairOccupancies() const;
+        std::vector<std::pair<Triplet, size_t>> getTriangleOccupancies() const;
+        // Fraction of the steps spent in edge types 1 and 2
+        std::pair<SparseMatrix<double>, SparseMatrix<double>> getPairOccupancyFractions() const;
+
+        // Saved in checkpoints so that a resumed chain continues the occupancies
+        void writeState(std::ostream&) const;
+        void readState(std::istream&);
+
+    private:
+        struct PairOccupancy {
+            size_t type;
+            size_t lastChange;
+            size_t steps[2];
+        };
+        struct TriangleOccupancy {
+            bool present;
+            size_t lastChange;
+            size_t steps;
+        };
+
+        const Hypergraph& hypergraph;
+        const bool correlation;
+        bool recording = false;
+        size_t stepNumber = 0;
+
+        // Only pairs and triangles that existed since the start are stored
+        std::vector<std::unordered_map<Index, PairOccupancy>> pairs;
+        std::unordered_map<size_t, TriangleOccupancy> triangles;
+
+        size_t getPairType(Index i, Index j) const;
+        size_t getTriangleKey(const Triplet& orderedTriplet) const;
+        void updatePair(Index i, Index j);
+        void updateTriangle(const Triplet& triplet);
+};
+
+} //namespace GRIT
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef GRIT_PARALLEL_H
+#define GRIT_PARALLEL_H
+
+
+#include <cstdint>
+#include <functional>
+#include <random>
+
+
+namespace GRIT {
+
+// Number of threads used for "taskNumber" tasks. 0 requests one thread per hardware thread.
+size_t getThreadNumber(size_t requestedThreads, size_t taskNumber);
+
+// Calls task(0), ..., task(taskNumber-1) on a pool of threads. The first exception thrown
+// by a task is rethrown once every thread has stopped.
+void runInParallel(size_t taskNumber, const std::function<void(size_t)>& task, size_t threadNumber=0);
+
+// Generators of the tasks of a parallel computation. The streams only depend on the seed,
+// which is drawn from GRIT::generator, so results don't depend on the number of threads.
+class TaskGenerators {
+    public:
+        TaskGenerators();
+        std::mt19937 get(size_t task) const;
+
+    private:
+        uint64_t seed;
+};
+
+} //namespace GRIT
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef GRIT_EDGE_PAIR_DATAWEIGHTED_CHOOSER_H
+#define GRIT_EDGE_PAIR_DATAWEIGHTED_CHOOSER_H
+
+#include <random>
+#include <vector>
+
+#include "GRIT/utility.h"
+#include "GRIT/proposers/movetypes.h"
+#include "chooser_base.h"
+
+
+namespace GRIT {
+
+// Chooses any pair with a weight of observations+1, whether it is an edge or not.
+// The probabilities don't depend on the hypergraph, so forward and reverse probabilities are equal.
+class ObservationsWeightedPairChooser: public EdgeChooserBase {
+    const Observations& observations;
+    std::vector<Edge> pairs;
+    std::discrete_distribution<size_t> distribution;
+    double totalWeight = 0;
+
+    public:
+        ObservationsWeightedPairChooser(const Observations& observations);
+        Edge choose();
+        double getForwardProbability(const Edge& chosenEdge, const AddRemoveMove& move) const;
+        double getReverseProbability(const Edge& chosenEdge, const AddRemoveMove& move) const;
+        void updateProbabilities(const Edge&, const AddRemoveMove&) {}
+        void recomputeDistribution() {}
+};
+
+} //namespace GRIT
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef GRIT_MOVE_ADAPTATION_H
+#define GRIT_MOVE_ADAPTATION_H
+
+
+#include <array>
+#include <iostream>
+#include <vector>
+
+#include "GRIT/proposers/movetypes.h"
+
+
+namespace GRIT {
+
+// Tunes the move type probabilities and eta of a proposer from the steps it makes.
+//  - Move types are drawn proportionally to their expected squared jump in hyperedge counts per unit of
+//    cost, mixed with the initial probabilities so that every move type keeps being proposed. The cost of
+//    a step is a deterministic proxy of its computation time, such as the number of pairs it evaluates,
+//    so that the adaptation only depends on the chain.
+//  - eta maximizes the acceptance rate estimated from the last acceptance ratios of additions and removals.
+//    Once the eta contribution is removed, these ratios don't depend on eta.
+// The stationary distribution doesn't depend on these values, but they must be frozen to sample.
+class MoveAdaptation {
+    public:
+        static const size_t UPDATE_INTERVAL = 10000;
+        static const size_t RATIO_BUFFER_SIZE = 4096;
+        static constexpr double INITIAL_PROBABILITIES_WEIGHT = 0.1;
+        static constexpr double MINIMUM_ETA = 0.05;
+        static constexpr double MAXIMUM_ETA = 0.95;
+
+        MoveAdaptation(const std::vector<double>& moveProbabilities, double eta);
+
+        // Returns true when the move probabilities and eta were updated
+        bool recordStep(size_t moveType, AddRemoveMove move, double logAcceptanceWithoutEta, double squaredJump, double cost);
+        // For moves whose proposal doesn't depend on eta
+        bool recordStep(size_t moveType, double squaredJump, double cost);
+
+        const std::vector<double>& getMoveProbabilities() const { return moveProbabilities; }
+        double getEta() const { return eta; }
+
+        void writeState(std::ostream&) const;
+        void readState(std::istream&);
+
+    private:
+        std::vector<double> initialMoveProbabilities, moveProbabilities;
+        std::vector<double> squaredJumpSums, costSums;
+        std::array<std::vector<double>, 2> logRatios;  // Ring buffers indexed by AddRemoveMove
+        std::array<size_t, 2> ratioPositions {0, 0};
+        double eta;
+        size_t stepsSinceUpdate = 0;
+
+        void updateMoveProbabilities();
+        void updateEta();
+};
+
+} //namespace GRIT
+
+#endif
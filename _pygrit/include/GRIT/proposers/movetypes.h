@@ -32,14 +32,17 @@ struct FourStepsHypergraphProposal{
 };
 
 struct SixStepsHypergraphProposal{
-    enum MoveType { NONE=0, EDGE, TRIANGLE, HIDDEN_EDGES };
+    enum MoveType { NONE=0, EDGE, TRIANGLE, HIDDEN_EDGES, PAIR, SHIFT };
 
-    AddRemoveMove move;
-    MoveType moveType;
-    Triplet chosenTriplet;
+    AddRemoveMove move = ADD;
+    MoveType moveType = NONE;
+    Triplet chosenTriplet {0, 0, 0};
     std::set<Edge> changedPairs;
-    size_t unchangedPairsNumber;
-    size_t maximumChangedPairsNumber;
+    size_t unchangedPairsNumber = 0;
+    size_t maximumChangedPairsNumber = 0;
+    // SHIFT moves replace the triangle chosenTriplet={i, j, k} by shiftedTriplet={i, j, l}.
+    // Both are equal when there is no triangle to shift.
+    Triplet shiftedTriplet {0, 0, 0};
 
     bool operator==(const SixStepsHypergraphProposal& other) const {
         return moveType == other.moveType && move == other.move && changedPairs == other.changedPairs;
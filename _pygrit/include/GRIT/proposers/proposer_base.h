@@ -1,9 +1,17 @@
 #ifndef GRIT_PROPOSER_BASE_H
 #define GRIT_PROPOSER_BASE_H
 
+#include <iostream>
+#include <vector>
+
 
 namespace GRIT {
 
+struct MoveParameters {
+    std::vector<double> moveProbabilities;
+    double eta = 0.5;
+};
+
 class ProposerBase {
     public:
         virtual void generateProposal() = 0;
@@ -11,6 +19,13 @@ class ProposerBase {
         virtual double getLogAcceptanceContribution() const = 0;
         virtual void recomputeProposersDistributions() = 0;
 
+        // While adapting, adaptToStep is called after every step with its log acceptance (see MoveAdaptation)
+        virtual void setAdaptation(bool) {}
+        virtual void adaptToStep(double, bool) {}
+        virtual MoveParameters getMoveParameters() const { return {}; }
+        virtual void writeState(std::ostream&) const {}
+        virtual void readState(std::istream&) {}
+
         virtual ~ProposerBase() {};
 };
 
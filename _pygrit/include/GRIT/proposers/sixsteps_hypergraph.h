@@ -8,6 +8,7 @@
 #include "GRIT/utility.h"
 #include "GRIT/proposers/movetypes.h"
 #include "proposer_base.h"
+#include "GRIT/proposers/move_adaptation.h"
 #include "GRIT/proposers/triangle-choosers/chooser_base.h"
 #include "GRIT/proposers/edge-choosers/chooser_base.h"
 
@@ -16,11 +17,17 @@ namespace GRIT {
 
 class HypergraphSixStepsProposer: public ProposerBase{
     Hypergraph& hypergraph;
+    const Observations& observations;
+    std::vector<size_t> observationsRowSums;
+    // observationsCumulativeRowSums[i][v] is the sum of observations[i][u] for u<v.
+    // Only built when the first SHIFT move is proposed, since it is as large as the observations.
+    std::vector<std::vector<size_t>> observationsCumulativeRowSums;
 
     TriangleChooserBase& triangleAdder;
     TriangleChooserBase& triangleRemover;
     EdgeChooserBase& edgeAdder;
     EdgeChooserBase& edgeRemover;
+    EdgeChooserBase* pairChooser = nullptr;
     double eta, chi_0, chi_1;
 
     size_t pairsUnder3edgeNumber=0;
@@ -28,6 +35,10 @@ class HypergraphSixStepsProposer: public ProposerBase{
     std::bernoulli_distribution addRemoveDistribution;
     std::discrete_distribution<int> moveTypeDistribution;
 
+    MoveAdaptation adaptation;
+    bool adapting = false;
+    double etaLogContribution = 0;
+
     public:
         SixStepsHypergraphProposal currentProposal;
 
@@ -45,14 +56,32 @@ class HypergraphSixStepsProposer: public ProposerBase{
         void proposeTriangle();
         void proposeEdge();
         void proposeHiddenEdges();
+        void proposePair();
+        void proposeTriangleShift();
+
+        // Required when a probability is given to PAIR moves (fourth move probability)
+        void setPairChooser(EdgeChooserBase& chooser) { pairChooser = &chooser; }
 
         double getLogAcceptanceContribution() const;
         bool applyStep();
         void recomputeProposersDistributions();
 
+        void setAdaptation(bool adapt) { adapting = adapt; }
+        void adaptToStep(double logAcceptance, bool hypergraphChanged);
+        MoveParameters getMoveParameters() const { return {moveTypeDistribution.probabilities(), eta}; }
+        void setMoveParameters(const std::vector<double>& moveProbabilities, double eta);
+        void writeState(std::ostream&) const;
+        void readState(std::istream&);
+
         void setProposal(const SixStepsHypergraphProposal& proposal) { currentProposal = proposal; };
 
     private:
+        void drawProposal();
+        double getEtaLogContribution() const;
+        double getShiftWeight(size_t vertex) const;
+        double getShiftTotalWeight() const;
+        double getShiftWeightUpTo(size_t vertex) const;
+        size_t drawShiftedVertex();
         void updatePairHiddenEdgeMove(size_t i, size_t j, std::set<Edge>& unchangedPairs);
 
 };
@@ -18,6 +18,8 @@ class TriangleChooserBase {
         virtual double getReverseProbability(const Triplet& triplet, const AddRemoveMove&) const = 0;
         virtual void updateProbabilities(const Triplet&, const AddRemoveMove&) = 0;
         virtual void recomputeDistribution() = 0;
+        // Whether every existing triangle is chosen with the same probability
+        virtual bool isUniform() const { return false; }
 
 };
 
@@ -22,6 +22,7 @@ class UniformTriangleChooser: public TriangleChooserBase{
         double getReverseProbability(const Triplet&, const AddRemoveMove&) const;
         void updateProbabilities(const Triplet& triplet, const AddRemoveMove& move);
         void recomputeDistribution();
+        bool isUniform() const { return true; }
     private:
         void buildSamplableSetFromGraph();
         void updateWeightOfIndex(const size_t& index, const AddRemoveMove& move);
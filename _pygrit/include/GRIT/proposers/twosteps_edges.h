@@ -8,6 +8,7 @@
 #include "GRIT/utility.h"
 #include "GRIT/proposers/edge-choosers/chooser_base.h"
 #include "proposer_base.h"
+#include "GRIT/proposers/move_adaptation.h"
 #include "GRIT/proposers/movetypes.h"
 
 
@@ -21,6 +22,10 @@ class EdgeTwoStepsProposer: public ProposerBase{
 
     double eta;
 
+    MoveAdaptation adaptation;
+    bool adapting = false;
+    double etaLogContribution = 0;
+
     public:
         TwoStepsEdgeProposal currentProposal;
 
@@ -32,6 +37,15 @@ class EdgeTwoStepsProposer: public ProposerBase{
         double getLogAcceptanceContribution() const;
         void recomputeProposersDistributions();
         bool applyStep();
+
+        void setAdaptation(bool adapt) { adapting = adapt; }
+        void adaptToStep(double logAcceptance, bool hypergraphChanged);
+        MoveParameters getMoveParameters() const { return {{1}, eta}; }
+        void writeState(std::ostream&) const;
+        void readState(std::istream&);
+
+    private:
+        double getEtaLogContribution() const;
 };
 
 } //namespace GRIT
@@ -0,0 +1,75 @@
+#ifndef GRIT_SAMPLE_READER_H
+#define GRIT_SAMPLE_READER_H
+
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "GRIT/compact_format.h"
+#include "GRIT/hypergraph.h"
+#include "GRIT/utility.h"
+
+
+namespace GRIT {
+
+
+// Edge type occurences of a chain, see getOccurencesFileName
+struct EdgeTypeOccurences {
+    size_t size = 0;
+    std::vector<size_t> edgetype1, edgetype2;  // size x size, row-major
+    size_t sampleNumber = 0;  // 0 for occurences written without it
+};
+
+// Read-only access to the samples of a chain written by GibbsBase. Compact samples
+// are memory-mapped and their hyperedge arrays are used in place. Samples in separate
+// files are converted once to the same sorted 32 bits triplets.
+class ChainSampleReader {
+    public:
+        ChainSampleReader(const std::string& chainDirectory, size_t chain, size_t sampleSize,
+                const std::string& hypergraphPrefix="hypergraph", const std::string& parametersPrefix="parameters");
+
+        size_t getSampleNumber() const { return samples.size(); }
+        size_t getSize() const { return size; }
+        size_t getParameterNumber() const { return parameterNumber; }
+        size_t getIteration(size_t sample) const { return samples.at(sample).iteration; }
+
+        // (i, j, multiplicity) and (i, j, k) triplets, sorted
+        const uint32_t* getEdges(size_t sample) const { return samples.at(sample).edges; }
+        const uint32_t* getTriangles(size_t sample) const { return samples.at(sample).triangles; }
+        size_t getEdgeNumber(size_t sample) const { return samples.at(sample).edgeNumber; }
+        size_t getTriangleNumber(size_t sample) const { return samples.at(sample).triangleNumber; }
+
+        const std::vector<double>& getParameters() const { return parameters; }  // samples x parameters, row-major
+        Hypergraph getHypergraph(size_t sample) const;
+
+        // Fills a samples x pairs array with the highest order hyperedge (withCorrelation) or the
+        // edge multiplicity of every pair. Pairs are in numpy.triu_indices order (see getPairIndex).
+        void fillPairTypes(int8_t* types, bool withCorrelation) const;
+
+        // The occurences don't require mapping the samples. hasOccurences is false when they weren't written.
+        static bool hasOccurences(const std::string& chainDirectory, size_t chain);
+        static EdgeTypeOccurences readOccurences(const std::string& chainDirectory, size_t chain);
+
+    private:
+        struct Sample {
+            size_t iteration;
+            std::shared_ptr<const CompactHypergraphFile> file;
+            std::vector<uint32_t> ownedEdges, ownedTriangles;
+            const uint32_t* edges;
+            const uint32_t* triangles;
+            size_t edgeNumber, triangleNumber;
+        };
+
+        size_t size = 0;
+        size_t parameterNumber = 0;
+        std::vector<Sample> samples;
+        std::vector<double> parameters;
+
+        void addSample(size_t iteration, const std::string& hypergraphPath);
+        void readParameters(const std::string& parametersPath);
+};
+
+} //namespace GRIT
+
+#endif
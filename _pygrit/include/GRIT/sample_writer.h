@@ -0,0 +1,91 @@
+#ifndef GRIT_SAMPLE_WRITER_H
+#define GRIT_SAMPLE_WRITER_H
+
+
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GRIT/hypergraph.h"
+#include "GRIT/utility.h"
+
+
+namespace GRIT {
+
+
+enum class SampleFormat { SEPARATE_FILES, COMPACT, COMPRESSED };
+
+// Dense size x size matrix of the number of samples in which each pair had the edge type,
+// written by the inference models next to the samples of the chain
+inline std::string getOccurencesFileName(const std::string& directory, size_t chain, size_t edgeType) {
+    return directory+"occurences"+std::to_string(chain)+"_edgetype"+std::to_string(edgeType)+".bin";
+}
+// Number of samples counted in the occurences. It is below the sample size when the chain was stopped early.
+inline std::string getOccurencesSampleNumberFileName(const std::string& directory, size_t chain) {
+    return directory+"occurences"+std::to_string(chain)+"_samplenumber.bin";
+}
+void writeChainOccurences(const SparseMatrix<size_t>& edgetype1, const SparseMatrix<size_t>& edgetype2, size_t sampleNumber,
+        const std::string& directory, size_t chain);
+
+// Flat copy of a hypergraph that is cheap to take and to hand over to another thread.
+struct HypergraphSnapshot {
+    size_t size;
+    std::vector<std::array<Index, 3>> edges;  // (i, j, multiplicity) with i<j
+    std::vector<Triplet> triangles;           // (i, j, k) with i<j<k
+
+    explicit HypergraphSnapshot(const Hypergraph& hypergraph);
+
+    // Same files and layout as Hypergraph::writeToBinary
+    void writeToBinary(const std::string& filePrefix) const;
+    void writeTrianglesToBinary(const std::string& fileName) const;
+    void writeEdgesToBinary(const std::string& fileName) const;
+    void writeToCompactBinary(const std::string& fileName, bool compress=false) const;  // see compact_format.h
+};
+
+struct SampleSnapshot {
+    HypergraphSnapshot hypergraph;
+    Parameters parameters;
+    std::string hypergraphFileName;
+    std::string parametersFileName;
+    SampleFormat format = SampleFormat::SEPARATE_FILES;
+};
+
+
+// Serializes samples on a background thread. The queue is bounded: "push" blocks
+// while it is full so that a slow disk throttles the sampler instead of the memory.
+class AsyncSampleWriter {
+    public:
+        explicit AsyncSampleWriter(size_t capacity=16);
+        ~AsyncSampleWriter();
+        AsyncSampleWriter(const AsyncSampleWriter&) = delete;
+        AsyncSampleWriter& operator=(const AsyncSampleWriter&) = delete;
+
+        void push(SampleSnapshot&& sample);
+        void flush();
+        size_t getCapacity() const { return capacity; }
+
+    private:
+        size_t capacity;
+        std::deque<SampleSnapshot> queue;
+        bool writing = false;
+        bool stopRequested = false;
+        std::exception_ptr writerError;
+
+        std::mutex mutex;
+        std::condition_variable queueNotEmpty;
+        std::condition_variable queueNotFull;
+        std::condition_variable queueDrained;
+        std::thread worker;
+
+        void writeSamples();
+        void rethrowWriterError();
+};
+
+} //namespace GRIT
+
+#endif
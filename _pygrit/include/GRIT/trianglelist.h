@@ -2,8 +2,10 @@
 #define GRIT_TRIANGLELIST_H
 
 
+#include <array>
 #include <vector>
 #include <set>
+#include <stdexcept>
 #include <unordered_map>
 #include <string>
 #include <algorithm>
@@ -21,10 +23,10 @@ struct Triplet {
     Index i;
     Index j;
     Index k;
-    bool operator==(const Triplet& other) {
+    bool operator==(const Triplet& other) const {
         return (i == other.i) && (j == other.j) && (k == other.k);
     }
-    bool operator!=(const Triplet& other) {
+    bool operator!=(const Triplet& other) const {
         return !(*this == other);
     }
     Triplet getOrdered() const {
@@ -49,10 +51,14 @@ class TriangleList {
         size_t getMaximumTriangleNumber() const { return nchoose3(size); }
 
         bool addTriangle(const Triplet&);
+        template<typename T>  // Fast path for loaders. Triplets (i<j<k) must be sorted and the list empty.
+        void addSortedTriangles(const T* orderedTriplets, size_t tripletNumber);
         bool removeTriangle(const Triplet&);
         bool isTriangle(const Triplet&) const;
         bool isPairCovered(const Index& i, const Index& j) const;
         bool isPairCoveredExluding(const Index& i, const Index& j, const Triplet&) const;
+        // Coverage of the pairs (i, j), (i, k) and (j, k) of an ordered triplet, found in a single pass
+        std::array<bool, 3> getTripletPairsCoverage(const Triplet& orderedTriplet, bool excludeTriplet) const;
 
         const AdjacentTriangles& getTrianglesFrom(Index vertex) const{ return triangles[vertex]; };
         Edge getNthTriangleOfVertex(const Index& vertex, const size_t& n) const;
@@ -69,6 +75,39 @@ class TriangleList {
         std::vector<AdjacentTriangles> triangles;
 };
 
+template<typename T>
+void TriangleList::addSortedTriangles(const T* orderedTriplets, size_t tripletNumber) {
+    if (triangleNumber != 0)
+        throw std::logic_error("Triangles can only be bulk added to an empty triangle list.");
+
+    std::vector<size_t> vertexTriangleNumber(size, 0);
+    for (size_t n=0; n<tripletNumber; n++) {
+        const T* triplet = orderedTriplets+3*n;
+        if (triplet[0] >= triplet[1] || triplet[1] >= triplet[2] || triplet[2] >= size)
+            throw std::logic_error("Bulk adding triangles: triplet is not ordered or out of range.");
+        if (n > 0 && !std::lexicographical_compare(triplet-3, triplet, triplet, triplet+3))
+            throw std::logic_error("Bulk adding triangles: triplets are not sorted or contain duplicates.");
+
+        for (size_t l=0; l<3; l++)
+            vertexTriangleNumber[triplet[l]]++;
+    }
+    for (Index vertex=0; vertex<size; vertex++)
+        triangles[vertex].reserve(vertexTriangleNumber[vertex]);
+
+    // Sorted triplets append values in increasing order to every set
+    for (size_t n=0; n<tripletNumber; n++) {
+        const Index i = orderedTriplets[3*n], j = orderedTriplets[3*n+1], k = orderedTriplets[3*n+2];
+
+        auto& neighbours_ij = triangles[i][j];
+        neighbours_ij.insert(neighbours_ij.end(), k);
+        auto& neighbours_ji = triangles[j][i];
+        neighbours_ji.insert(neighbours_ji.end(), k);
+        auto& neighbours_ki = triangles[k][i];
+        neighbours_ki.insert(neighbours_ki.end(), j);
+    }
+    triangleNumber = tripletNumber;
+}
+
 } //namespace GRIT
 
 #endif
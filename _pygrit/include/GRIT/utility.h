@@ -51,6 +51,8 @@ struct Edge: std::pair<size_t, size_t> {
 
 size_t nchoose2(size_t n);
 size_t nchoose3(size_t n);
+// Position of the pair (i, j), i<j, in the row-major upper triangle of a n x n matrix (same order as numpy.triu_indices)
+inline size_t getPairIndex(size_t i, size_t j, size_t n) { return i*(2*n-i-1)/2 + j-i-1; }
 void createOrEmptyDirectory(const std::string& directory);
 long getFileSize(std::string filename);
 
@@ -69,9 +71,16 @@ double drawFromTruncatedGammaITS(double inf, double sup, double k, double theta)
 double drawTruncatedGammaWithLinearRS(double inf, double sup, double k, double theta, size_t maxit=1e6);
 double drawTruncatedGammaWithGammaRS(double inf, double sup, double k, double theta, size_t maxit=1e6);
 double drawTruncatedGammaWithUniformRS(double inf, double sup, double k, double theta, size_t maxit=1e6);
+// Rejection sampling with a piecewise envelope whose acceptance probability is bounded below for any truncation
+double drawTruncatedGammaWithEnvelopeRS(double inf, double sup, double k, double theta, size_t maxit=1e5);
 
 void writeParametersToBinary(const Parameters& parameters, const std::string& filename);
 
+template<typename T>
+void writeBinaryValue(std::ostream& stream, const T& value) { stream.write((const char*) &value, sizeof(T)); }
+template<typename T>
+void readBinaryValue(std::istream& stream, T& value) { stream.read((char*) &value, sizeof(T)); }
+
 template<typename T> // Doesn't write file in a sparse format
 void writeSparseMatrixToBinary(const SparseMatrix<T>& sparseMatrix, const std::string& filename) {
     size_t size = sparseMatrix.size();
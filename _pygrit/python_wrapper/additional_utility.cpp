@@ -9,6 +9,9 @@
 
 #include "GRIT/hypergraph.h"
 #include "GRIT/utility.h"
+#include "GRIT/average_hypergraph.h"
+#include "GRIT/hypergraph_transformations.h"
+#include "GRIT/metrics.h"
 
 
 namespace py = pybind11;
@@ -71,41 +74,6 @@ std::list<std::tuple<size_t, size_t, size_t>> getDecreasingOrderedPairs(const py
 }
 
 
-GRIT::Hypergraph removeDisconnectedVertices(const GRIT::Hypergraph& hypergraph) {
-    size_t previousNonEmptyVertex=0;
-    std::map<size_t, size_t> newIndices;
-
-    for (size_t i=0; i<hypergraph.getSize(); i++)
-        if (hypergraph.getEdgesFrom(i).size()>0 or hypergraph.getTrianglesFrom(i).size()>0)
-            newIndices[i] = previousNonEmptyVertex++;
-
-    GRIT::Hypergraph filteredHypergraph(previousNonEmptyVertex);
-    for (size_t i=0; i<hypergraph.getSize(); i++) {
-        for (auto& _2neighbour: hypergraph.getEdgesFrom(i))
-            if (i<_2neighbour.first)
-                filteredHypergraph.addMultiedge(newIndices[i], newIndices[_2neighbour.first], _2neighbour.second);
-
-        for (auto& first_3neighbour: hypergraph.getTrianglesFrom(i))
-            if (i < first_3neighbour.first)
-            for (auto& second_3neighbour: first_3neighbour.second)
-                if (first_3neighbour.first < second_3neighbour)
-                    filteredHypergraph.addTriangle(
-                        {newIndices[i], newIndices[first_3neighbour.first], newIndices[second_3neighbour]});
-    }
-    return filteredHypergraph;
-}
-
-
-GRIT::Hypergraph projectHypergraphOnGraph(const GRIT::Hypergraph& hypergraph) {
-    GRIT::Hypergraph graph(hypergraph.getSize());
-
-    for (size_t i=0; i<hypergraph.getSize(); i++)
-        for (size_t j=i+1; j<hypergraph.getSize(); j++)
-            if (hypergraph.getHighestOrderHyperedgeWith(i, j) > 0)
-                graph.addEdge(i, j);
-    return graph;
-}
-
 GRIT::Hypergraph generateHypergraphFromAdjacencyMatrix(const py::array_t<size_t>& adjacencyMatrix) {
     py::buffer_info adjacencyBuffer = adjacencyMatrix.request();
     size_t* adjacencyPtr = (size_t*) adjacencyBuffer.ptr;
@@ -121,159 +89,20 @@ GRIT::Hypergraph generateHypergraphFromAdjacencyMatrix(const py::array_t<size_t>
     return graph;
 }
 
-GRIT::Hypergraph projectHypergraphOnMultigraph(const GRIT::Hypergraph& hypergraph) {
-    GRIT::Hypergraph graph(hypergraph.getSize());
-
-    size_t edgeMultiplicity;
-    for (size_t i=0; i<hypergraph.getSize(); i++)
-        for (size_t j=i+1; j<hypergraph.getSize(); j++) {
-            edgeMultiplicity = hypergraph.getHighestOrderHyperedgeWith(i, j);
-            if (edgeMultiplicity > 0)
-                graph.addMultiedge(i, j, edgeMultiplicity);
-        }
-    return graph;
-}
-
-GRIT::Hypergraph getAverageHypergraph(std::list<std::string>& fileNames) {
-    std::vector<std::map<std::pair<size_t, size_t>, size_t>> triangleOccurences;
-    std::map<std::pair<size_t, size_t>, size_t> edgeOccurences;
-
-    size_t sampleSize = fileNames.size();
-    size_t graphSize = 0;
-    for (auto& fileName: fileNames) {
-        GRIT::Hypergraph hypergraph = GRIT::Hypergraph::loadFromBinary(fileName);
-        if (graphSize == 0) {
-            graphSize = hypergraph.getSize();
-            triangleOccurences.resize(graphSize);
-        }
-        else
-            if (graphSize != hypergraph.getSize())
-                throw std::logic_error("Hypergraph average: a hypergraph has size "+std::to_string(graphSize)+
-                        " while another has size "+std::to_string(hypergraph.getSize()));
-
-        for (size_t i=0; i<hypergraph.getSize(); i++) {
-
-            for (auto& j: hypergraph.getEdgesFrom(i)) {
-                if (i >= j.first)
-                    continue;
-
-                if (edgeOccurences.find({i, j.first}) == edgeOccurences.end())
-                    edgeOccurences[{i, j.first}] = 1;
-                else
-                    edgeOccurences[{i, j.first}]++;
-
-            }
-
-            for (auto& triangleNeighbour: hypergraph.getTrianglesFrom(i)) {
-                auto& j = triangleNeighbour.first;
-                if (i >= j)
-                    continue;
-
-                for (auto& k: triangleNeighbour.second) {
-                    std::pair<size_t, size_t> edge = {j, k};
-                    if (triangleOccurences[i].find(edge) == triangleOccurences[i].end())
-                        triangleOccurences[i][edge] = 1;
-                    else
-                        triangleOccurences[i][edge] ++;
-                }
-            }
-        }
-    }
-
-    GRIT::Hypergraph averageHypergraph(graphSize);
-    for (auto& edge: edgeOccurences)
-        if ((double) edge.second/sampleSize >= 0.5)
-            averageHypergraph.addEdge(edge.first.first, edge.first.second);
-
-    for (size_t i=0; i<triangleOccurences.size(); i++)
-        for (auto& neighbours: triangleOccurences[i])
-            if ((double) neighbours.second/sampleSize >= 0.5)
-                averageHypergraph.addTriangle({i, neighbours.first.first, neighbours.first.second});
-    return averageHypergraph;
+GRIT::Hypergraph getAverageHypergraph(const std::vector<std::string>& fileNames, size_t threadNumber) {
+    py::gil_scoped_release release;
+    return GRIT::accumulateHypergraphFiles(fileNames, false, threadNumber).getAverageHypergraph();
 }
 
-
-GRIT::Hypergraph getAverageHypergraphEdgeStrength(std::list<std::string>& fileNames) {
-    std::map<std::pair<size_t, size_t>, size_t> weakEdgeOccurences;
-    std::map<std::pair<size_t, size_t>, size_t> strongEdgeOccurences;
-
-    size_t sampleSize = fileNames.size();
-    size_t graphSize = 0;
-    for (auto& fileName: fileNames) {
-        GRIT::Hypergraph hypergraph = GRIT::Hypergraph::loadFromBinary(fileName);
-        if (graphSize == 0) {
-            graphSize = hypergraph.getSize();
-        }
-        else
-            if (graphSize != hypergraph.getSize())
-                throw std::logic_error("Hypergraph average: a hypergraph has size "+std::to_string(graphSize)+
-                        " while another has size "+std::to_string(hypergraph.getSize()));
-
-        for (size_t i=0; i<hypergraph.getSize(); i++) {
-
-            for (auto& j: hypergraph.getEdgesFrom(i)) {
-                if (i >= j.first)
-                    continue;
-
-                if (j.second == 1) {
-                    if (weakEdgeOccurences.find({i, j.first}) == weakEdgeOccurences.end())
-                        weakEdgeOccurences[{i, j.first}] = 1;
-                    else
-                        weakEdgeOccurences[{i, j.first}]++;
-                }
-                else {
-                    if (strongEdgeOccurences.find({i, j.first}) == strongEdgeOccurences.end())
-                        strongEdgeOccurences[{i, j.first}] = 1;
-                    else
-                        strongEdgeOccurences[{i, j.first}]++;
-                }
-            }
-        }
-    }
-
-    GRIT::Hypergraph averageHypergraph(graphSize);
-    for (auto& weakEdge: weakEdgeOccurences)
-        if ((double) weakEdge.second/sampleSize >= 0.5)
-            averageHypergraph.addEdge(weakEdge.first.first, weakEdge.first.second);
-
-    for (auto& strongEdge: strongEdgeOccurences)
-        if ((double) strongEdge.second/sampleSize >= 0.5)
-            averageHypergraph.addMultiedge(strongEdge.first.first, strongEdge.first.second, 2);
-
-    return averageHypergraph;
+GRIT::Hypergraph getAverageHypergraphEdgeStrength(const std::vector<std::string>& fileNames, size_t threadNumber) {
+    py::gil_scoped_release release;
+    return GRIT::accumulateHypergraphFiles(fileNames, true, threadNumber).getAverageHypergraph();
 }
 
-
-size_t getEdgeHammingDistance(const GRIT::Hypergraph& hypergraph1, const GRIT::Hypergraph& hypergraph2){
-    size_t hammingDistance = 0;
-    if (hypergraph1.getSize() != hypergraph2.getSize()) throw std::logic_error("Edge hamming distance: hypergraphs have different sizes");
-
-    size_t hyperedgeType1, hyperedgeType2;
-    for (size_t i=0; i<hypergraph1.getSize(); i++) {
-        for (size_t j=i+1; j<hypergraph1.getSize(); j++) {
-            hyperedgeType1 = hypergraph1.getEdgeMultiplicity(i, j);
-            hyperedgeType2 = hypergraph2.getEdgeMultiplicity(i, j);
-            if ( hyperedgeType1 != hyperedgeType2 )
-                hammingDistance++;
-        }
-    }
-    return hammingDistance;
-}
-
-size_t getGlobalHammingDistance(const GRIT::Hypergraph& hypergraph1, const GRIT::Hypergraph& hypergraph2){
-    size_t hammingDistance = 0;
-    if (hypergraph1.getSize() != hypergraph2.getSize()) throw std::logic_error("Edge hamming distance: hypergraphs have different sizes");
-
-    size_t hyperedgeType1, hyperedgeType2;
-    for (size_t i=0; i<hypergraph1.getSize(); i++) {
-        for (size_t j=i+1; j<hypergraph1.getSize(); j++) {
-            hyperedgeType1 = hypergraph1.getHighestOrderHyperedgeWith(i, j);
-            hyperedgeType2 = hypergraph2.getHighestOrderHyperedgeWith(i, j);
-            if ( hyperedgeType1 != hyperedgeType2 )
-                hammingDistance++;
-        }
-    }
-    return hammingDistance;
+std::vector<size_t> getHammingDistancesToFiles(const GRIT::Hypergraph& reference, const std::vector<std::string>& fileNames,
+        bool global, size_t threadNumber) {
+    py::gil_scoped_release release;
+    return GRIT::getHammingDistancesToFiles(reference, fileNames, global, threadNumber);
 }
 
 
@@ -281,13 +110,22 @@ void defineAdditionalUtils(py::module &m) {
     m.def("get_neg_mixture_likelihood", &getNegMixtureLikelihood);
     m.def("get_decreasing_ordered_pairs", &getDecreasingOrderedPairs);
 
-    m.def("get_edge_hamming_distance", &getEdgeHammingDistance);
-    m.def("get_global_hamming_distance", &getGlobalHammingDistance);
+    m.def("get_edge_hamming_distance", &GRIT::getEdgeHammingDistance);
+    m.def("get_global_hamming_distance", &GRIT::getGlobalHammingDistance);
+    m.def("get_hamming_distances_to_files", &getHammingDistancesToFiles, py::arg("reference"), py::arg("file_names"), py::arg("global_distance")=false, py::arg("thread_number")=0);
 
-    m.def("remove_disconnected_vertices", &removeDisconnectedVertices);
-    m.def("project_hypergraph_on_multigraph", &projectHypergraphOnMultigraph);
-    m.def("project_hypergraph_on_graph", &projectHypergraphOnGraph);
+    m.def("remove_disconnected_vertices", &GRIT::removeDisconnectedVertices);
+    m.def("project_hypergraph_on_multigraph", &GRIT::projectHypergraphOnMultigraph);
+    m.def("project_hypergraph_on_graph", &GRIT::projectHypergraphOnGraph);
     m.def("generate_hypergraph_from_adjacency", &generateHypergraphFromAdjacencyMatrix);
-    m.def("get_average_hypergraph", &getAverageHypergraph);
-    m.def("get_average_hypergraph_edgestrength", &getAverageHypergraphEdgeStrength);
+    m.def("get_average_hypergraph", &getAverageHypergraph, py::arg("file_names"), py::arg("thread_number")=0);
+    m.def("get_average_hypergraph_edgestrength", &getAverageHypergraphEdgeStrength, py::arg("file_names"), py::arg("thread_number")=0);
+
+    // Average of hypergraphs held in memory, such as the samples streamed by a model
+    py::class_<GRIT::AverageHypergraphAccumulator> (m, "AverageHypergraph")
+        .def(py::init<bool>(), py::arg("edge_strength")=false)
+        .def("add", &GRIT::AverageHypergraphAccumulator::add, py::arg("hypergraph"))
+        .def("merge", &GRIT::AverageHypergraphAccumulator::merge, py::arg("other"))
+        .def("get_sample_size", &GRIT::AverageHypergraphAccumulator::getSampleSize)
+        .def("get_average_hypergraph", &GRIT::AverageHypergraphAccumulator::getAverageHypergraph, py::arg("threshold")=0.5);
 }
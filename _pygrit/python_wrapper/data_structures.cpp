@@ -39,6 +39,8 @@ void defineDataStructures(py::module &m) {
         .def("get_triangles_from", &GRIT::Hypergraph::getTrianglesFrom)
         .def("load_from_binary", &GRIT::Hypergraph::loadFromBinary)
         .def("write_to_binary", &GRIT::Hypergraph::writeToBinary)
+        .def("write_to_compact_binary", &GRIT::Hypergraph::writeToCompactBinary, py::arg("filename"), py::arg("compress")=false)
+        .def_static("load_from_compact_binary", &GRIT::Hypergraph::loadFromCompactBinary, py::arg("filename"))
         .def("write_to_csv", &GRIT::Hypergraph::writeToCSV)
         .def("get_copy", [](const GRIT::Hypergraph& self){ return GRIT::Hypergraph(self); });
 }
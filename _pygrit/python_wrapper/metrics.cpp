@@ -2,51 +2,24 @@
 #include <pybind11/stl.h>
 #include <pybind11/numpy.h>
 
-#include <map>
+#include <cstdint>
+#include <stdexcept>
 #include <vector>
 
 #include "GRIT/hypergraph.h"
 #include "GRIT/utility.h"
+#include "GRIT/metrics.h"
 
 
 namespace py = pybind11;
 
 
-void addEdgeIfInexistent(size_t i, size_t j, std::map<std::pair<size_t, size_t>, bool>& edgeInTriangle) {
-    auto edge = std::make_pair(i, j);
-    if (!edgeInTriangle.count(edge))
-        edgeInTriangle[edge] = 1;
-}
-
-size_t countEdgesInTriangles(const py::array_t<size_t>& edgeTypes) {
+size_t countEdgesInTriangles(const py::array_t<size_t>& edgeTypes, size_t threadNumber) {
     py::buffer_info edgeTypesBuffer = edgeTypes.request();
-    size_t* L = (size_t*) edgeTypesBuffer.ptr;
-    size_t n = edgeTypesBuffer.shape[0];
+    if (edgeTypesBuffer.ndim != 2 || edgeTypesBuffer.shape[0] != edgeTypesBuffer.shape[1])
+        throw std::runtime_error("Count edges in triangles: Edge types must be a square matrix.");
 
-    std::map<std::pair<size_t, size_t>, bool> edgeInTriangle;
-    size_t Lij, Lik, Ljk;
-
-    for (size_t i=0; i<n; i++) {
-        for (size_t j=i+1; j<n; j++) {
-            Lij = L[i*n + j];
-            if (Lij == 0)
-                continue;
-
-            for (size_t k=j+1; k<n; k++) {
-                Lik = L[i*n + k];
-                Ljk = L[j*n + k];
-                if (Lik>0 && Ljk>0) {
-                    if (Lij==1)
-                        addEdgeIfInexistent(i, j, edgeInTriangle);
-                    if (Lik==1)
-                        addEdgeIfInexistent(i, k, edgeInTriangle);
-                    if (Ljk==1)
-                        addEdgeIfInexistent(j, k, edgeInTriangle);
-                }
-            }
-        }
-    }
-    return edgeInTriangle.size();
+    return GRIT::countEdgesInTriangles((const size_t*) edgeTypesBuffer.ptr, edgeTypesBuffer.shape[0], threadNumber);
 }
 
 
@@ -79,62 +52,118 @@ std::vector<size_t> getConfusionMatrix(const GRIT::Hypergraph& groundtruth, cons
     return confusionMatrix;
 }
 
-std::array<double, 3> getSumOfResidualsOfTypes(const py::list& edgetypes, const py::array_t<size_t>& X1, const py::array_t<size_t>& X2) {
-    py::buffer_info X1_buffer = X1.request();
-    py::buffer_info X2_buffer = X2.request();
+typedef py::array_t<int8_t, py::array::c_style | py::array::forcecast> EdgeTypesArray;
+typedef py::array_t<uint32_t, py::array::c_style | py::array::forcecast> CountsArray;
 
-    if (X1_buffer.size != X2_buffer.size)
-        throw std::runtime_error("Sum of residuals: Input shapes must match.");
+// Residuals of a replicate (1D array of pair counts) or of a stack of replicates (2D array)
+static std::vector<GRIT::ResidualsOfTypes> getResidualsOfReplicates(const EdgeTypesArray& edgeTypes, const CountsArray& observations,
+        const CountsArray& replicates, size_t threadNumber) {
+    py::buffer_info edgeTypesBuffer = edgeTypes.request();
+    py::buffer_info observationsBuffer = observations.request();
+    py::buffer_info replicatesBuffer = replicates.request();
+
+    size_t pairNumber = edgeTypesBuffer.size;
+    if (edgeTypesBuffer.ndim != 1 || observationsBuffer.ndim != 1 || (size_t) observationsBuffer.size != pairNumber)
+        throw std::runtime_error("Sum of residuals: Edge types and observations must be arrays of the same length.");
+    if (replicatesBuffer.ndim < 1 || replicatesBuffer.ndim > 2 || (size_t) replicatesBuffer.shape[replicatesBuffer.ndim-1] != pairNumber)
+        throw std::runtime_error("Sum of residuals: Replicates must be arrays of the length of the observations.");
+
+    size_t replicateNumber = replicatesBuffer.ndim == 2 ? replicatesBuffer.shape[0] : 1;
+    py::gil_scoped_release release;
+    return GRIT::getResidualsOfTypes((const int8_t*) edgeTypesBuffer.ptr, (const uint32_t*) observationsBuffer.ptr,
+            (const uint32_t*) replicatesBuffer.ptr, replicateNumber, pairNumber, threadNumber);
+}
+
+// Sums of residuals and of absolute residuals by type, each of shape (3,) or (replicates, 3)
+py::tuple getResidualsOfTypes(const EdgeTypesArray& edgeTypes, const CountsArray& observations, const CountsArray& replicates, size_t threadNumber) {
+    auto residuals = getResidualsOfReplicates(edgeTypes, observations, replicates, threadNumber);
+
+    std::vector<ssize_t> shape {3};
+    if (replicates.ndim() == 2)
+        shape.insert(shape.begin(), residuals.size());
+    py::array_t<double> sums(shape), absoluteSums(shape);
+    double *sumsPtr = (double *) sums.request().ptr;
+    double *absoluteSumsPtr = (double *) absoluteSums.request().ptr;
+
+    for (size_t replicate=0; replicate<residuals.size(); replicate++)
+        for (size_t type=0; type<3; type++) {
+            sumsPtr[3*replicate+type] = residuals[replicate].sums[type];
+            absoluteSumsPtr[3*replicate+type] = residuals[replicate].absoluteSums[type];
+        }
+    return py::make_tuple(sums, absoluteSums);
+}
+
+std::array<double, 3> getSumOfResidualsOfPairTypes(const EdgeTypesArray& edgeTypes, const CountsArray& X1, const CountsArray& X2, size_t threadNumber) {
+    if (X2.ndim() != 1)
+        throw std::runtime_error("Sum of residuals: Observations must be arrays of pair counts.");
+    return getResidualsOfReplicates(edgeTypes, X1, X2, threadNumber)[0].sums;
+}
 
-    size_t n = X1_buffer.shape[0];
+std::array<double, 3> getSumOfAbsoluteResidualsOfPairTypes(const EdgeTypesArray& edgeTypes, const CountsArray& X1, const CountsArray& X2, size_t threadNumber) {
+    if (X2.ndim() != 1)
+        throw std::runtime_error("Sum of residuals: Observations must be arrays of pair counts.");
+    return getResidualsOfReplicates(edgeTypes, X1, X2, threadNumber)[0].absoluteSums;
+}
 
-    size_t *X1_ptr = (size_t *) X1_buffer.ptr,
-           *X2_ptr = (size_t *) X2_buffer.ptr;
+typedef py::array_t<size_t, py::array::c_style | py::array::forcecast> CountsMatrix;
 
-    std::array<double, 3> residuals = {0, 0, 0};
-    size_t totalPosition = 0;
+// Counts of the pairs (i, j), i<j, of a square matrix in row-major order
+static std::vector<uint32_t> getUpperTriangle(const CountsMatrix& matrix) {
+    py::buffer_info buffer = matrix.request();
+    if (buffer.ndim != 2 || buffer.shape[0] != buffer.shape[1])
+        throw std::runtime_error("Sum of residuals: Observations must be square matrices.");
+
+    size_t n = buffer.shape[0];
+    const size_t* matrixPtr = (const size_t*) buffer.ptr;
+    std::vector<uint32_t> upperTriangle;
+    upperTriangle.reserve(n*(n-1)/2);
     for (size_t i=0; i<n; i++)
         for (size_t j=i+1; j<n; j++) {
-            residuals[edgetypes[totalPosition].cast<size_t>()] +=
-                (double)X1_ptr[i*n+j] - (double)X2_ptr[i*n+j];
-            totalPosition++;
+            if (matrixPtr[i*n+j] > UINT32_MAX)
+                throw std::runtime_error("Sum of residuals: Observations must fit in 32 bits.");
+            upperTriangle.push_back(matrixPtr[i*n+j]);
         }
-
-    return residuals;
+    return upperTriangle;
 }
 
-std::array<double, 3> getSumOfAbsoluteResidualsOfTypes(const py::list& edgetypes, const py::array_t<size_t>& X1, const py::array_t<size_t>& X2) {
-    py::buffer_info X1_buffer = X1.request();
-    py::buffer_info X2_buffer = X2.request();
-
-    if (X1_buffer.size != X2_buffer.size)
+// Residuals of the upper triangles of two n x n observation matrices
+static GRIT::ResidualsOfTypes getResidualsOfMatrices(const EdgeTypesArray& edgeTypes, const CountsMatrix& X1, const CountsMatrix& X2, size_t threadNumber) {
+    auto observations1 = getUpperTriangle(X1);
+    auto observations2 = getUpperTriangle(X2);
+    if (observations1.size() != observations2.size())
         throw std::runtime_error("Sum of residuals: Input shapes must match.");
 
-    size_t n = X1_buffer.shape[0];
+    py::buffer_info edgeTypesBuffer = edgeTypes.request();
+    if (edgeTypesBuffer.ndim != 1 || (size_t) edgeTypesBuffer.size != observations1.size())
+        throw std::runtime_error("Sum of residuals: There must be one edge type per pair of vertices.");
 
-    size_t *X1_ptr = (size_t *) X1_buffer.ptr,
-           *X2_ptr = (size_t *) X2_buffer.ptr;
+    py::gil_scoped_release release;
+    return GRIT::getResidualsOfTypes((const int8_t*) edgeTypesBuffer.ptr, observations1.data(), observations2.data(),
+            1, observations1.size(), threadNumber)[0];
+}
 
-    std::array<double, 3> residuals = {0, 0, 0};
-    size_t totalPosition = 0;
-    for (size_t i=0; i<n; i++)
-        for (size_t j=i+1; j<n; j++) {
-            residuals[edgetypes[totalPosition].cast<size_t>()] +=
-                std::abs((double)X1_ptr[i*n+j] - (double)X2_ptr[i*n+j]);
-            totalPosition++;
-        }
+std::array<double, 3> getSumOfResidualsOfTypes(const EdgeTypesArray& edgeTypes, const CountsMatrix& X1, const CountsMatrix& X2, size_t threadNumber) {
+    return getResidualsOfMatrices(edgeTypes, X1, X2, threadNumber).sums;
+}
 
-    return residuals;
+std::array<double, 3> getSumOfAbsoluteResidualsOfTypes(const EdgeTypesArray& edgeTypes, const CountsMatrix& X1, const CountsMatrix& X2, size_t threadNumber) {
+    return getResidualsOfMatrices(edgeTypes, X1, X2, threadNumber).absoluteSums;
 }
 
 void defineMetrics(py::module &m) {
-    m.def("count_edges_in_triangles", &countEdgesInTriangles);
+    m.def("count_edges_in_triangles", &countEdgesInTriangles, py::arg("edge_types"), py::arg("thread_number")=0);
 
     m.def("get_confusion_matrix", &getConfusionMatrix,
             py::arg("groundtruth"), py::arg("average edge types"),
             py::arg("with_correlation")=false, py::arg("edge_types_swapped")=false);
     m.def("get_sum_residuals_of_types", &getSumOfResidualsOfTypes,
-            py::arg("edge_types"), py::arg("observations1"), py::arg("observations2"));
+            py::arg("edge_types"), py::arg("observations1"), py::arg("observations2"), py::arg("thread_number")=0);
     m.def("get_sum_absolute_residuals_of_types", &getSumOfAbsoluteResidualsOfTypes,
-            py::arg("edge_types"), py::arg("observations1"), py::arg("observations2"));
+            py::arg("edge_types"), py::arg("observations1"), py::arg("observations2"), py::arg("thread_number")=0);
+    m.def("get_sum_residuals_of_pair_types", &getSumOfResidualsOfPairTypes,
+            py::arg("edge_types"), py::arg("observations1"), py::arg("observations2"), py::arg("thread_number")=0);
+    m.def("get_sum_absolute_residuals_of_pair_types", &getSumOfAbsoluteResidualsOfPairTypes,
+            py::arg("edge_types"), py::arg("observations1"), py::arg("observations2"), py::arg("thread_number")=0);
+    m.def("get_residuals_of_types", &getResidualsOfTypes,
+            py::arg("edge_types"), py::arg("observations"), py::arg("replicates"), py::arg("thread_number")=0);
 }
@@ -1,6 +1,8 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <memory>
+
 #include "GRIT/hypergraph.h"
 #include "GRIT/utility.h"
 #include "GRIT/inference-models/phg.h"
@@ -11,7 +13,86 @@
 namespace py = pybind11;
 
 
+// Sampling runs without the GIL, which is only taken back to call the Python sink. The sink is
+// shared so that copying the std::function never changes Python reference counts, and the last
+// owner takes the GIL to release it.
+template<typename Model>
+static void setPythonSampleSink(Model& model, py::object sink) {
+    if (sink.is_none()) {
+        model.setSampleSink(nullptr);
+        return;
+    }
+    std::shared_ptr<py::object> callable(new py::object(std::move(sink)), [](py::object* object) {
+        py::gil_scoped_acquire acquire;
+        delete object;
+    });
+    model.setSampleSink([callable](const GRIT::ChainSample& sample) {
+        py::gil_scoped_acquire acquire;
+        py::object stop = (*callable)(sample);
+        return !stop.is_none() && stop.cast<bool>();
+    });
+}
+
+// Same entries as the JSON file written next to the samples
+static py::dict getMoveStatisticsDict(const InferenceModel& model) {
+    py::dict statistics;
+    const auto& moveStatistics = model.getMoveStatistics();
+
+    for (size_t moveType=0; moveType<GRIT::MoveStatistics::MOVE_TYPE_NUMBER; moveType++)
+        for (auto move: {GRIT::ADD, GRIT::REMOVE}) {
+            auto& counters = moveStatistics.get(moveType, move);
+            if (counters.proposed == 0)
+                continue;
+
+            py::dict moveDict;
+            moveDict["proposed"] = counters.proposed;
+            moveDict["accepted"] = counters.accepted;
+            moveDict["unchanged"] = counters.unchanged;
+            for (size_t phase=0; phase<GRIT::MoveStatistics::PHASE_NUMBER; phase++)
+                moveDict[(std::string(GRIT::MoveStatistics::getPhaseName(phase))+" time").c_str()] = counters.time[phase];
+
+            statistics[(std::string(GRIT::MoveStatistics::getMoveTypeName(moveType))+(move == GRIT::ADD ? " add" : " remove")).c_str()] = moveDict;
+        }
+    return statistics;
+}
+
+static py::dict getMoveParametersDict(const InferenceModel& model) {
+    py::dict moveParameters;
+    moveParameters["move probabilities"] = model.getMoveParameters().moveProbabilities;
+    moveParameters["eta"] = model.getMoveParameters().eta;
+    return moveParameters;
+}
+
+static void setConvergenceTargets(InferenceModel& model, double effectiveSampleSize, double gewekeZScore, double splitRHat) {
+    model.setConvergenceTargets({effectiveSampleSize, gewekeZScore, splitRHat});
+}
+
+static py::dict getConvergenceDiagnosticsDict(const InferenceModel& model, size_t chain) {
+    py::dict diagnostics;
+    for (auto& quantity: model.getConvergenceDiagnostics(chain)) {
+        py::dict quantityDict;
+        quantityDict["sample size"] = quantity.sampleSize;
+        quantityDict["mean"] = quantity.mean;
+        quantityDict["effective sample size"] = quantity.effectiveSampleSize;
+        quantityDict["geweke z-score"] = quantity.gewekeZScore;
+        quantityDict["split r-hat"] = quantity.splitRHat;
+        diagnostics[quantity.name.c_str()] = quantityDict;
+    }
+    return diagnostics;
+}
+
+
 void defineModels(py::module &m) {
+    m.attr("move_statistics_enabled") = InferenceModel::isCollectingMoveStatistics();
+    m.attr("move_statistics_time_unit") = GRIT::MoveStatistics::getTimeUnit();
+
+    py::class_<GRIT::ChainSample> (m, "ChainSample")
+        .def_readonly("chain", &GRIT::ChainSample::chain)
+        .def_readonly("iteration", &GRIT::ChainSample::iteration)
+        .def_readonly("parameters", &GRIT::ChainSample::parameters)
+        .def_property_readonly("hypergraph", [](const GRIT::ChainSample& self) -> const GRIT::Hypergraph& {
+                return *self.hypergraph;
+            }, py::return_value_policy::reference_internal);
 
     py::class_<PHG> (m, "PHG")
         .def(py::init<size_t, double, size_t, size_t,
@@ -22,9 +103,28 @@ void defineModels(py::module &m) {
                 py::arg("model_hyperparameters"), py::arg("move_probabilities")
             )
         .def("set_hyperparameters", &PHG::setHyperparameters, py::arg("hyperparameters"))
+        .def("set_sample_format", &PHG::setSampleFormat, py::arg("sample_format"))
+        .def("set_sample_sink", &setPythonSampleSink<PHG>, py::arg("sink"))
+        .def("set_write_samples", &PHG::setWriteSamples, py::arg("write_samples"))
+        .def("get_write_samples", &PHG::getWriteSamples)
+        .def("set_checkpoint_interval", &PHG::setCheckpointInterval, py::arg("checkpoint_interval"))
+        .def("set_canonicalization_interval", &PHG::setCanonicalizationInterval, py::arg("canonicalization_interval"))
+        .def("set_adaptive_moves", &PHG::setAdaptiveMoves, py::arg("adaptive_moves"))
+        .def("set_occupancy_accumulation", &PHG::setOccupancyAccumulation, py::arg("accumulate"))
+        .def("set_convergence_targets", &setConvergenceTargets,
+                py::arg("effective_sample_size")=0, py::arg("geweke_z_score")=0, py::arg("split_r_hat")=0)
+        .def("get_convergence_diagnostics", &getConvergenceDiagnosticsDict, py::arg("chain"))
+        .def("get_move_statistics", &getMoveStatisticsDict)
+        .def("get_move_parameters", &getMoveParametersDict)
+        .def("resume", &PHG::resume,
+                py::arg("sample_size"), py::arg("burnin"), py::arg("chain"),
+                py::arg("hypergraph"), py::arg("parameters"), py::arg("observations"), py::arg("output_directory"),
+                py::call_guard<py::gil_scoped_release>()
+            )
         .def("sample", &PHG::sample,
                 py::arg("sample_size"), py::arg("burnin"), py::arg("chain"),
-                py::arg("hypergraph"), py::arg("parameters"), py::arg("observations"), py::arg("output_directory")
+                py::arg("hypergraph"), py::arg("parameters"), py::arg("observations"), py::arg("output_directory"),
+                py::call_guard<py::gil_scoped_release>()
             )
         .def("sample_hypergraph_chain", &PHG::sampleHypergraphs,
                 py::arg("mh_steps"), py::arg("points"), py::arg("gibbs_iterations"),
@@ -48,13 +148,32 @@ void defineModels(py::module &m) {
                 py::arg("model_hyperparameters"), py::arg("move_probabilities")
             )
         .def("set_hyperparameters", &PES::setHyperparameters, py::arg("hyperparameters"))
+        .def("set_sample_format", &PES::setSampleFormat, py::arg("sample_format"))
+        .def("set_sample_sink", &setPythonSampleSink<PES>, py::arg("sink"))
+        .def("set_write_samples", &PES::setWriteSamples, py::arg("write_samples"))
+        .def("get_write_samples", &PES::getWriteSamples)
+        .def("set_checkpoint_interval", &PES::setCheckpointInterval, py::arg("checkpoint_interval"))
+        .def("set_canonicalization_interval", &PES::setCanonicalizationInterval, py::arg("canonicalization_interval"))
+        .def("set_adaptive_moves", &PES::setAdaptiveMoves, py::arg("adaptive_moves"))
+        .def("set_occupancy_accumulation", &PES::setOccupancyAccumulation, py::arg("accumulate"))
+        .def("set_convergence_targets", &setConvergenceTargets,
+                py::arg("effective_sample_size")=0, py::arg("geweke_z_score")=0, py::arg("split_r_hat")=0)
+        .def("get_convergence_diagnostics", &getConvergenceDiagnosticsDict, py::arg("chain"))
+        .def("get_move_statistics", &getMoveStatisticsDict)
+        .def("get_move_parameters", &getMoveParametersDict)
+        .def("resume", &PES::resume,
+                py::arg("sample_size"), py::arg("burnin"), py::arg("chain"),
+                py::arg("hypergraph"), py::arg("parameters"), py::arg("observations"), py::arg("output_directory"),
+                py::call_guard<py::gil_scoped_release>()
+            )
         .def("sample_hypergraph_chain", &PES::sampleHypergraphs,
                 py::arg("mh_steps"), py::arg("points"), py::arg("gibbs_iterations"),
                 py::arg("hypergraph"), py::arg("parameters"), py::arg("observations"), py::arg("output_directory")
             )
         .def("sample", &PES::sample,
                 py::arg("sample_size"), py::arg("burnin"), py::arg("chain"),
-                py::arg("hypergraph"), py::arg("parameters"), py::arg("observations"), py::arg("output_directory")
+                py::arg("hypergraph"), py::arg("parameters"), py::arg("observations"), py::arg("output_directory"),
+                py::call_guard<py::gil_scoped_release>()
             )
         .def("get_loglikelihood", &PES::getLogLikelihood,
                 py::arg("hypergraph"), py::arg("parameters"), py::arg("observations")
@@ -74,13 +193,32 @@ void defineModels(py::module &m) {
                 py::arg("model_hyperparameters"), py::arg("move_probabilities")
             )
         .def("set_hyperparameters", &PER::setHyperparameters, py::arg("hyperparameters"))
+        .def("set_sample_format", &PER::setSampleFormat, py::arg("sample_format"))
+        .def("set_sample_sink", &setPythonSampleSink<PER>, py::arg("sink"))
+        .def("set_write_samples", &PER::setWriteSamples, py::arg("write_samples"))
+        .def("get_write_samples", &PER::getWriteSamples)
+        .def("set_checkpoint_interval", &PER::setCheckpointInterval, py::arg("checkpoint_interval"))
+        .def("set_canonicalization_interval", &PER::setCanonicalizationInterval, py::arg("canonicalization_interval"))
+        .def("set_adaptive_moves", &PER::setAdaptiveMoves, py::arg("adaptive_moves"))
+        .def("set_occupancy_accumulation", &PER::setOccupancyAccumulation, py::arg("accumulate"))
+        .def("set_convergence_targets", &setConvergenceTargets,
+                py::arg("effective_sample_size")=0, py::arg("geweke_z_score")=0, py::arg("split_r_hat")=0)
+        .def("get_convergence_diagnostics", &getConvergenceDiagnosticsDict, py::arg("chain"))
+        .def("get_move_statistics", &getMoveStatisticsDict)
+        .def("get_move_parameters", &getMoveParametersDict)
+        .def("resume", &PER::resume,
+                py::arg("sample_size"), py::arg("burnin"), py::arg("chain"),
+                py::arg("hypergraph"), py::arg("parameters"), py::arg("observations"), py::arg("output_directory"),
+                py::call_guard<py::gil_scoped_release>()
+            )
         .def("sample_hypergraph_chain", &PER::sampleHypergraphs,
                 py::arg("mh_steps"), py::arg("points"), py::arg("gibbs_iterations"),
                 py::arg("hypergraph"), py::arg("parameters"), py::arg("observations"), py::arg("output_directory")
             )
         .def("sample", &PER::sample,
                 py::arg("sample_size"), py::arg("burnin"), py::arg("chain"),
-                py::arg("hypergraph"), py::arg("parameters"), py::arg("observations"), py::arg("output_directory")
+                py::arg("hypergraph"), py::arg("parameters"), py::arg("observations"), py::arg("output_directory"),
+                py::call_guard<py::gil_scoped_release>()
             )
         .def("get_loglikelihood", &PER::getLogLikelihood,
                 py::arg("hypergraph"), py::arg("parameters"), py::arg("observations")
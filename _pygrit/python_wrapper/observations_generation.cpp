@@ -3,6 +3,7 @@
 
 #include "GRIT/hypergraph.h"
 #include "GRIT/utility.h"
+#include "GRIT/observations_generation.h"
 
 #include <pybind11/numpy.h>
 
@@ -10,37 +11,66 @@
 namespace py = pybind11;
 
 
-py::array_t<size_t> generatePoissonObservations(const GRIT::Hypergraph& hypergraph, double mu0, double mu1, double mu2, bool withTriangles){
+py::array_t<size_t> generatePoissonObservations(const GRIT::Hypergraph& hypergraph, double mu0, double mu1, double mu2, bool withTriangles, size_t threadNumber){
     size_t n = hypergraph.getSize();
+    auto sparseObservations = GRIT::PoissonObservationsGenerator(hypergraph, {mu0, mu1, mu2}, withTriangles).generateSparse(threadNumber);
 
     py::array_t<size_t> observations({n, n});
     py::buffer_info observationsBuffer = observations.request();
     size_t *observationsPtr = (size_t *) observationsBuffer.ptr;
+    std::fill(observationsPtr, observationsPtr+n*n, 0);
 
-    std::poisson_distribution<size_t> distribution[3] = {
-                            std::poisson_distribution<size_t>(mu0),
-                            std::poisson_distribution<size_t>(mu1),
-                            std::poisson_distribution<size_t>(mu2)};
-
-    size_t hyperedgeType, observationsElement;
-    for (size_t i=0; i<n; i++){
-        observationsPtr[i*n+i] = 0; // initialize diagonal to 0
-        for (size_t j=i+1; j<n; j++){
-            if (withTriangles)
-                hyperedgeType = hypergraph.getHighestOrderHyperedgeWith(i, j);
-            else
-                hyperedgeType = hypergraph.getEdgeMultiplicity(i, j);
-            if (hyperedgeType > 2)
-                hyperedgeType = 2;
-
-            observationsElement = distribution[hyperedgeType](GRIT::generator);
-            observationsPtr[i*n+j] = observationsElement;
-            observationsPtr[j*n+i] = observationsElement;
+    for (size_t i=0; i<n; i++)
+        for (auto& j_count: sparseObservations[i]) {
+            observationsPtr[i*n+j_count.first] = j_count.second;
+            observationsPtr[j_count.first*n+i] = j_count.second;
         }
+    return observations;
+}
+
+// Upper triangle of the non-zero counts as (rows, columns, counts)
+py::tuple generateSparsePoissonObservations(const GRIT::Hypergraph& hypergraph, double mu0, double mu1, double mu2, bool withTriangles, size_t threadNumber){
+    auto sparseObservations = GRIT::PoissonObservationsGenerator(hypergraph, {mu0, mu1, mu2}, withTriangles).generateSparse(threadNumber);
+
+    size_t nonZeroNumber = 0;
+    for (auto& row: sparseObservations)
+        nonZeroNumber += row.size();
+
+    py::array_t<size_t> rows(nonZeroNumber), columns(nonZeroNumber), counts(nonZeroNumber);
+    size_t *rowsPtr = (size_t *) rows.request().ptr;
+    size_t *columnsPtr = (size_t *) columns.request().ptr;
+    size_t *countsPtr = (size_t *) counts.request().ptr;
+
+    size_t position = 0;
+    for (size_t i=0; i<sparseObservations.size(); i++)
+        for (auto& j_count: sparseObservations[i]) {
+            rowsPtr[position] = i;
+            columnsPtr[position] = j_count.first;
+            countsPtr[position] = j_count.second;
+            position++;
+        }
+    return py::make_tuple(rows, columns, counts);
+}
+
+// Replicates of the counts of the pairs (i, j), i<j, in row-major order of the upper triangle
+py::array_t<uint32_t> generatePoissonObservationsBatch(const GRIT::Hypergraph& hypergraph, const std::vector<double>& means,
+        size_t replicateNumber, size_t threadNumber, bool withTriangles){
+    GRIT::PoissonObservationsGenerator generator(hypergraph, means, withTriangles);
+
+    py::array_t<uint32_t> observations({replicateNumber, generator.getPairNumber()});
+    uint32_t *observationsPtr = (uint32_t *) observations.request().ptr;
+    {
+        py::gil_scoped_release release;
+        generator.generateBatch(replicateNumber, observationsPtr, threadNumber);
     }
     return observations;
 }
 
 void defineRandomObservationsGeneration(py::module &m) {
-    m.def("generate_poisson_observations", &generatePoissonObservations);
+    m.def("generate_poisson_observations", &generatePoissonObservations,
+            py::arg("hypergraph"), py::arg("mu0"), py::arg("mu1"), py::arg("mu2"), py::arg("with_triangles"), py::arg("thread_number")=0);
+    m.def("generate_poisson_observations_sparse", &generateSparsePoissonObservations,
+            py::arg("hypergraph"), py::arg("mu0"), py::arg("mu1"), py::arg("mu2"), py::arg("with_triangles"), py::arg("thread_number")=0);
+    m.def("generate_poisson_observations_batch", &generatePoissonObservationsBatch,
+            py::arg("hypergraph"), py::arg("mu"), py::arg("replicate_number"), py::arg("thread_number")=0, py::arg("with_triangles")=true);
 }
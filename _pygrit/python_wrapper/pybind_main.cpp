@@ -17,6 +17,7 @@ void defineMetrics(py::module &m);
 void defineModels(py::module &m);
 void defineRandomHypergraphFunctions(py::module &m);
 void defineRandomObservationsGeneration(py::module &m);
+void defineSampleReader(py::module &m);
 
 
 void seedRNG(size_t _seed) {
@@ -30,6 +31,7 @@ PYBIND11_MODULE(pygrit, m) {
     defineMetrics(m);
     defineRandomHypergraphFunctions(m);
     defineRandomObservationsGeneration(m);
+    defineSampleReader(m);
 
     m.def("seed", &seedRNG);
 
@@ -41,5 +43,6 @@ PYBIND11_MODULE(pygrit, m) {
     m.def("sample_from_truncgamma_its", &GRIT::drawFromTruncatedGammaITS);
     m.def("sample_from_truncgamma_uniform_rs", &GRIT::drawTruncatedGammaWithUniformRS);
     m.def("sample_from_truncgamma_linear_rs", &GRIT::drawTruncatedGammaWithLinearRS);
+    m.def("sample_from_truncgamma_envelope_rs", &GRIT::drawTruncatedGammaWithEnvelopeRS);
     m.def("sample_from_upper_truncgamma_its", &GRIT::drawFromUpperTruncatedGammaITS);
 }
@@ -0,0 +1,73 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/numpy.h>
+
+#include "GRIT/sample_reader.h"
+
+
+namespace py = pybind11;
+
+
+// The returned array is a read-only view on the reader's memory, which "owner" keeps alive
+static py::array_t<uint32_t> getTripletsView(const uint32_t* triplets, size_t tripletNumber, py::object owner) {
+    py::array_t<uint32_t> view({(py::ssize_t) tripletNumber, (py::ssize_t) 3}, triplets, owner);
+    view.attr("flags").attr("writeable") = false;
+    return view;
+}
+
+
+void defineSampleReader(py::module &m) {
+
+    py::class_<GRIT::ChainSampleReader, std::shared_ptr<GRIT::ChainSampleReader>> (m, "ChainSampleReader")
+        .def(py::init<const std::string&, size_t, size_t>(),
+                py::arg("chain_directory"), py::arg("chain"), py::arg("sample_size"))
+        .def("get_sample_number", &GRIT::ChainSampleReader::getSampleNumber)
+        .def("get_size", &GRIT::ChainSampleReader::getSize)
+        .def("get_iteration", &GRIT::ChainSampleReader::getIteration, py::arg("sample"))
+        .def("get_hypergraph", &GRIT::ChainSampleReader::getHypergraph, py::arg("sample"))
+        .def("get_edges", [](py::object self, size_t sample) {
+                const auto& reader = self.cast<const GRIT::ChainSampleReader&>();
+                return getTripletsView(reader.getEdges(sample), reader.getEdgeNumber(sample), self);
+            }, py::arg("sample"))
+        .def("get_triangles", [](py::object self, size_t sample) {
+                const auto& reader = self.cast<const GRIT::ChainSampleReader&>();
+                return getTripletsView(reader.getTriangles(sample), reader.getTriangleNumber(sample), self);
+            }, py::arg("sample"))
+        .def("get_edge_numbers", [](const GRIT::ChainSampleReader& self) {
+                py::array_t<size_t> edgeNumbers(self.getSampleNumber());
+                for (size_t s=0; s<self.getSampleNumber(); s++)
+                    edgeNumbers.mutable_data()[s] = self.getEdgeNumber(s);
+                return edgeNumbers;
+            })
+        .def("get_triangle_numbers", [](const GRIT::ChainSampleReader& self) {
+                py::array_t<size_t> triangleNumbers(self.getSampleNumber());
+                for (size_t s=0; s<self.getSampleNumber(); s++)
+                    triangleNumbers.mutable_data()[s] = self.getTriangleNumber(s);
+                return triangleNumbers;
+            })
+        .def("get_parameters", [](py::object self) {
+                const auto& reader = self.cast<const GRIT::ChainSampleReader&>();
+                py::array_t<double> parameters({(py::ssize_t) reader.getSampleNumber(), (py::ssize_t) reader.getParameterNumber()},
+                                               reader.getParameters().data(), self);
+                parameters.attr("flags").attr("writeable") = false;
+                return parameters;
+            })
+        .def("get_types", [](const GRIT::ChainSampleReader& self, bool withCorrelation) {
+                py::array_t<int8_t> types({(py::ssize_t) self.getSampleNumber(), (py::ssize_t) GRIT::nchoose2(self.getSize())});
+                self.fillPairTypes(types.mutable_data(), withCorrelation);
+                return types;
+            }, py::arg("with_correlation")=true)
+        // (edgetype1, edgetype2, sample number) with flattened size x size occurences, None when they weren't written.
+        // The sample number is None for occurences written without it.
+        .def_static("read_occurences", [](const std::string& chainDirectory, size_t chain) -> py::object {
+                if (!GRIT::ChainSampleReader::hasOccurences(chainDirectory, chain))
+                    return py::none();
+                auto occurences = GRIT::ChainSampleReader::readOccurences(chainDirectory, chain);
+                py::object sampleNumber = py::none();
+                if (occurences.sampleNumber > 0)
+                    sampleNumber = py::int_(occurences.sampleNumber);
+                return py::make_tuple(py::array_t<size_t>(occurences.edgetype1.size(), occurences.edgetype1.data()),
+                                      py::array_t<size_t>(occurences.edgetype2.size(), occurences.edgetype2.data()),
+                                      sampleNumber);
+            }, py::arg("chain_directory"), py::arg("chain"));
+}
@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "GRIT/average_hypergraph.h"
+#include "GRIT/parallel.h"
+
+
+namespace GRIT {
+
+void AverageHypergraphAccumulator::setSize(size_t hypergraphSize) {
+    if (sampleSize == 0)
+        size = hypergraphSize;
+    else if (size != hypergraphSize)
+        throw std::logic_error("Hypergraph average: a hypergraph has size "+std::to_string(size)+
+                " while another has size "+std::to_string(hypergraphSize));
+}
+
+void AverageHypergraphAccumulator::add(const Hypergraph& hypergraph) {
+    setSize(hypergraph.getSize());
+    sampleSize++;
+
+    for (Index i=0; i<size; i++) {
+        for (auto& neighbour: hypergraph.getEdgesFrom(i)) {
+            if (i >= neighbour.first)
+                continue;
+            if (edgeStrength && neighbour.second > 1)
+                strongEdgeOccurrences[i*size+neighbour.first]++;
+            else
+                edgeOccurrences[i*size+neighbour.first]++;
+        }
+
+        if (edgeStrength)
+            continue;
+        for (auto& triangleNeighbours: hypergraph.getTrianglesFrom(i)) {
+            Index j = triangleNeighbours.first;
+            if (i >= j)
+                continue;
+            for (auto k: triangleNeighbours.second)
+                triangleOccurrences[(i*size+j)*size+k]++;
+        }
+    }
+}
+
+static void mergeOccurrences(std::unordered_map<size_t, size_t>& occurrences, const std::unordered_map<size_t, size_t>& otherOccurrences) {
+    for (auto& key_occurrences: otherOccurrences)
+        occurrences[key_occurrences.first] += key_occurrences.second;
+}
+
+void AverageHypergraphAccumulator::merge(const AverageHypergraphAccumulator& other) {
+    if (edgeStrength != other.edgeStrength)
+        throw std::logic_error("Hypergraph average: cannot merge averages of edge strength and of hypergraphs.");
+    if (other.sampleSize == 0)
+        return;
+
+    setSize(other.size);
+    sampleSize += other.sampleSize;
+    mergeOccurrences(edgeOccurrences, other.edgeOccurrences);
+    mergeOccurrences(strongEdgeOccurrences, other.strongEdgeOccurrences);
+    mergeOccurrences(triangleOccurrences, other.triangleOccurrences);
+}
+
+// Keys of the hyperedges found in at least a fraction "threshold" of the sample, sorted
+static std::vector<size_t> getFrequentKeys(const std::unordered_map<size_t, size_t>& occurrences, size_t sampleSize, double threshold) {
+    std::vector<size_t> keys;
+    for (auto& key_occurrences: occurrences)
+        if ((double) key_occurrences.second/sampleSize >= threshold)
+            keys.push_back(key_occurrences.first);
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+Hypergraph AverageHypergraphAccumulator::getAverageHypergraph(double threshold) const {
+    Hypergraph averageHypergraph(size);
+    if (sampleSize == 0)
+        return averageHypergraph;
+
+    for (auto key: getFrequentKeys(edgeOccurrences, sampleSize, threshold))
+        averageHypergraph.addEdge(key/size, key%size);
+    for (auto key: getFrequentKeys(strongEdgeOccurrences, sampleSize, threshold))
+        averageHypergraph.addMultiedge(key/size, key%size, 2);
+    for (auto key: getFrequentKeys(triangleOccurrences, sampleSize, threshold))
+        averageHypergraph.addTriangle({key/(size*size), (key/size)%size, key%size});
+    return averageHypergraph;
+}
+
+AverageHypergraphAccumulator accumulateHypergraphFiles(const std::vector<std::string>& fileNames, bool edgeStrength, size_t threadNumber) {
+    size_t workerNumber = getThreadNumber(threadNumber, fileNames.size());
+    std::vector<AverageHypergraphAccumulator> workerAccumulators(workerNumber, AverageHypergraphAccumulator(edgeStrength));
+
+    runInParallel(workerNumber, [&](size_t worker) {
+        for (size_t file=worker; file<fileNames.size(); file+=workerNumber)
+            workerAccumulators[worker].add(Hypergraph::loadFromBinary(fileNames[file]));
+    }, workerNumber);
+
+    AverageHypergraphAccumulator accumulator(edgeStrength);
+    for (auto& workerAccumulator: workerAccumulators)
+        accumulator.merge(workerAccumulator);
+    return accumulator;
+}
+
+} //namespace GRIT
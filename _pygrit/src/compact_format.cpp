@@ -0,0 +1,245 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "GRIT/compact_format.h"
+
+
+namespace GRIT {
+using namespace std;
+
+
+static uint64_t computeChecksum(const char* data, size_t length) {  // FNV-1a on 64 bits words
+    const uint64_t prime = 1099511628211ULL;
+    uint64_t hash = 14695981039346656037ULL;
+    uint64_t word;
+
+    size_t i = 0;
+    for (; i+sizeof(uint64_t) <= length; i+=sizeof(uint64_t)) {
+        memcpy(&word, data+i, sizeof(uint64_t));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < length; i++)
+        hash = (hash ^ (unsigned char) data[i]) * prime;
+    return hash;
+}
+
+static void writeVarint(vector<char>& buffer, uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back((char) ((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back((char) value);
+}
+
+static uint64_t readVarint(const char*& position, const char* end) {
+    uint64_t value = 0;
+    for (size_t shift=0; shift<64; shift+=7) {
+        if (position == end)
+            throw runtime_error("Compact hypergraph: compressed data is truncated.");
+
+        unsigned char byte = *position++;
+        value |= (uint64_t) (byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return value;
+    }
+    throw runtime_error("Compact hypergraph: invalid variable length integer.");
+}
+
+// Third element is either a vertex (triangles) or a multiplicity (edges)
+static vector<char> encodeTriplets(const vector<CompactTriplet>& triplets, bool thirdIsVertex) {
+    vector<char> buffer;
+    buffer.reserve(4*triplets.size());
+
+    CompactTriplet previous {0, 0, 0};
+    for (size_t n=0; n<triplets.size(); n++) {
+        auto& triplet = triplets[n];
+        bool sameFirst = n>0 && triplet[0] == previous[0];
+        bool sameFirstTwo = sameFirst && triplet[1] == previous[1];
+
+        writeVarint(buffer, triplet[0] - (n>0 ? previous[0] : 0));
+        writeVarint(buffer, triplet[1] - (sameFirst ? previous[1] : triplet[0]));
+        if (thirdIsVertex)
+            writeVarint(buffer, triplet[2] - (sameFirstTwo ? previous[2] : triplet[1]));
+        else
+            writeVarint(buffer, triplet[2]);
+        previous = triplet;
+    }
+    return buffer;
+}
+
+static vector<uint32_t> decodeTriplets(const char* data, size_t length, size_t tripletNumber, bool thirdIsVertex) {
+    vector<uint32_t> triplets(3*tripletNumber);
+    const char* position = data;
+    const char* end = data+length;
+
+    uint64_t previous[3] {0, 0, 0};
+    uint64_t current[3];
+    for (size_t n=0; n<tripletNumber; n++) {
+        current[0] = (n>0 ? previous[0] : 0) + readVarint(position, end);
+        bool sameFirst = n>0 && current[0] == previous[0];
+        current[1] = (sameFirst ? previous[1] : current[0]) + readVarint(position, end);
+        bool sameFirstTwo = sameFirst && current[1] == previous[1];
+
+        if (thirdIsVertex)
+            current[2] = (sameFirstTwo ? previous[2] : current[1]) + readVarint(position, end);
+        else
+            current[2] = readVarint(position, end);
+
+        for (size_t l=0; l<3; l++) {
+            if (current[l] > numeric_limits<uint32_t>::max())
+                throw runtime_error("Compact hypergraph: decoded value overflows 32 bits.");
+            triplets[3*n+l] = current[l];
+            previous[l] = current[l];
+        }
+    }
+    if (position != end)
+        throw runtime_error("Compact hypergraph: unexpected data after the compressed triplets.");
+    return triplets;
+}
+
+
+MemoryMappedFile::MemoryMappedFile(const string& fileName) {
+    int fileDescriptor = open(fileName.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+        throw runtime_error("The file \""+fileName+"\" could not be open.");
+
+    struct stat fileStatus;
+    if (fstat(fileDescriptor, &fileStatus) != 0) {
+        close(fileDescriptor);
+        throw runtime_error("Could not get the size of \""+fileName+"\".");
+    }
+    length = fileStatus.st_size;
+
+    if (length > 0) {
+        void* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (mapping == MAP_FAILED) {
+            close(fileDescriptor);
+            throw runtime_error("The file \""+fileName+"\" could not be memory mapped.");
+        }
+        data = (const char*) mapping;
+        madvise(mapping, length, MADV_SEQUENTIAL);
+    }
+    close(fileDescriptor);  // The mapping stays valid
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+    if (data != nullptr)
+        munmap((void*) data, length);
+}
+
+
+CompactHypergraphFile::CompactHypergraphFile(const string& fileName): file(new MemoryMappedFile(fileName)) {
+    const char* data = file->getData();
+    size_t length = file->getLength();
+
+    if (length < sizeof(CompactHypergraphHeader))
+        throw runtime_error("\""+fileName+"\" is too small to be a compact hypergraph.");
+    memcpy(&header, data, sizeof(CompactHypergraphHeader));
+
+    if (memcmp(header.magic, COMPACT_HYPERGRAPH_MAGIC, sizeof(header.magic)) != 0)
+        throw runtime_error("\""+fileName+"\" is not a compact hypergraph.");
+    if (header.version != COMPACT_HYPERGRAPH_VERSION)
+        throw runtime_error("\""+fileName+"\" has unsupported compact hypergraph version "+to_string(header.version)+".");
+
+    const char* payload = data + sizeof(CompactHypergraphHeader);
+    size_t payloadLength = length - sizeof(CompactHypergraphHeader);
+
+    if (header.edgeBytes + header.triangleBytes != payloadLength)
+        throw runtime_error("\""+fileName+"\" is truncated or has an invalid header.");
+    if (computeChecksum(payload, payloadLength) != header.checksum)
+        throw runtime_error("\""+fileName+"\" is corrupted: checksum mismatch.");
+
+    if (isCompressed()) {
+        decodedEdges = decodeTriplets(payload, header.edgeBytes, header.edgeNumber, false);
+        decodedTriangles = decodeTriplets(payload+header.edgeBytes, header.triangleBytes, header.triangleNumber, true);
+        edges = decodedEdges.data();
+        triangles = decodedTriangles.data();
+    }
+    else {
+        if (header.edgeBytes != sizeof(CompactTriplet)*header.edgeNumber
+                || header.triangleBytes != sizeof(CompactTriplet)*header.triangleNumber)
+            throw runtime_error("\""+fileName+"\" has an invalid header.");
+
+        // The header size is a multiple of 8 bytes, so the arrays are aligned
+        edges = (const uint32_t*) payload;
+        triangles = (const uint32_t*) (payload + header.edgeBytes);
+    }
+}
+
+Hypergraph CompactHypergraphFile::toHypergraph() const {
+    Hypergraph hypergraph(header.size);
+    hypergraph.addSortedEdges(edges, header.edgeNumber);
+    hypergraph.addSortedTriangles(triangles, header.triangleNumber);
+    return hypergraph;
+}
+
+bool CompactHypergraphFile::isCompactHypergraph(const string& fileName) {
+    ifstream fileStream(fileName, ios::in|ios::binary);
+    char magic[sizeof(COMPACT_HYPERGRAPH_MAGIC)];
+
+    return fileStream.read(magic, sizeof(magic)) && memcmp(magic, COMPACT_HYPERGRAPH_MAGIC, sizeof(magic)) == 0;
+}
+
+
+static void validateTriplets(vector<CompactTriplet>& triplets, size_t size, bool thirdIsVertex, const string& name) {
+    for (auto& triplet: triplets)
+        if (triplet[0] >= triplet[1] || triplet[1] >= size || (thirdIsVertex && (triplet[1] >= triplet[2] || triplet[2] >= size))
+                || (!thirdIsVertex && triplet[2] == 0))
+            throw logic_error("Writing compact hypergraph: "+name+" must be ordered, nonempty and within the hypergraph size.");
+
+    sort(triplets.begin(), triplets.end());
+    if (adjacent_find(triplets.begin(), triplets.end()) != triplets.end())
+        throw logic_error("Writing compact hypergraph: duplicated "+name+".");
+}
+
+void writeCompactHypergraph(const string& fileName, size_t size,
+        vector<CompactTriplet> edges, vector<CompactTriplet> triangles, bool compress) {
+    if (size > numeric_limits<uint32_t>::max())
+        throw logic_error("Writing compact hypergraph: vertex indices must fit in 32 bits.");
+    validateTriplets(edges, size, false, "edges");
+    validateTriplets(triangles, size, true, "triangles");
+
+    vector<char> payload;
+    CompactHypergraphHeader header;
+    memcpy(header.magic, COMPACT_HYPERGRAPH_MAGIC, sizeof(header.magic));
+    header.version = COMPACT_HYPERGRAPH_VERSION;
+    header.flags = compress ? COMPACT_HYPERGRAPH_COMPRESSED : 0;
+    header.size = size;
+    header.edgeNumber = edges.size();
+    header.triangleNumber = triangles.size();
+
+    if (compress) {
+        payload = encodeTriplets(edges, false);
+        header.edgeBytes = payload.size();
+
+        auto encodedTriangles = encodeTriplets(triangles, true);
+        header.triangleBytes = encodedTriangles.size();
+        payload.insert(payload.end(), encodedTriangles.begin(), encodedTriangles.end());
+    }
+    else {
+        header.edgeBytes = edges.size()*sizeof(CompactTriplet);
+        header.triangleBytes = triangles.size()*sizeof(CompactTriplet);
+        payload.resize(header.edgeBytes + header.triangleBytes);
+
+        memcpy(payload.data(), edges.data(), header.edgeBytes);
+        memcpy(payload.data()+header.edgeBytes, triangles.data(), header.triangleBytes);
+    }
+    header.checksum = computeChecksum(payload.data(), payload.size());
+
+    ofstream fileStream(fileName, ios::out|ios::binary);
+    if (!fileStream.is_open()) throw runtime_error("The file \""+fileName+"\" could not be open to save the hypergraph.");
+
+    fileStream.write((char*) &header, sizeof(CompactHypergraphHeader));
+    fileStream.write(payload.data(), payload.size());
+    if (!fileStream) throw runtime_error("Could not write the hypergraph to \""+fileName+"\".");
+}
+
+} //namespace GRIT
@@ -0,0 +1,267 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "GRIT/utility.h"
+#include "GRIT/convergence_diagnostics.h"
+
+
+namespace GRIT {
+
+static const double NaN = std::numeric_limits<double>::quiet_NaN();
+
+void Moments::add(double value) {
+    count++;
+    double delta = value-mean;
+    mean += delta/count;
+    squaredDeviations += delta*(value-mean);
+}
+
+void Moments::merge(const Moments& other) {
+    if (other.count == 0)
+        return;
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+    size_t total = count+other.count;
+    double delta = other.mean-mean;
+    mean += delta*other.count/total;
+    squaredDeviations += other.squaredDeviations + delta*delta*count*other.count/total;
+    count = total;
+}
+
+
+void StreamingBatchMeans::push(double value) {
+    currentBatch.add(value);
+    if (currentBatch.count < batchSize)
+        return;
+
+    batches.push_back(currentBatch);
+    currentBatch = Moments();
+
+    if (batches.size() == BATCH_NUMBER) {
+        for (size_t i=0; i<BATCH_NUMBER/2; i++) {
+            batches[i] = batches[2*i];
+            batches[i].merge(batches[2*i+1]);
+        }
+        batches.resize(BATCH_NUMBER/2);
+        batchSize *= 2;
+    }
+}
+
+static Moments mergeBatches(std::vector<Moments>::const_iterator begin, std::vector<Moments>::const_iterator end) {
+    Moments moments;
+    for (auto it=begin; it!=end; it++)
+        moments.merge(*it);
+    return moments;
+}
+
+// Moments of the means of the batches
+static Moments getBatchMeansMoments(std::vector<Moments>::const_iterator begin, std::vector<Moments>::const_iterator end) {
+    Moments moments;
+    for (auto it=begin; it!=end; it++)
+        moments.add(it->mean);
+    return moments;
+}
+
+Moments StreamingBatchMeans::getMoments() const {
+    return mergeBatches(batches.begin(), batches.end());
+}
+
+double StreamingBatchMeans::getEffectiveSampleSize() const {
+    if (!hasEnoughSamples())
+        return NaN;
+
+    Moments moments = getMoments();
+    double asymptoticVariance = batchSize*getBatchMeansMoments(batches.begin(), batches.end()).getVariance();
+    if (asymptoticVariance == 0)
+        return moments.count;
+    return moments.count*moments.getVariance()/asymptoticVariance;
+}
+
+double StreamingBatchMeans::getGewekeZScore() const {
+    if (!hasEnoughSamples())
+        return NaN;
+
+    size_t firstBatches = std::max<size_t>(2, batches.size()/10);
+    size_t lastBatches = batches.size()/2;
+    Moments first = getBatchMeansMoments(batches.begin(), batches.begin()+firstBatches);
+    Moments last = getBatchMeansMoments(batches.end()-lastBatches, batches.end());
+
+    double difference = first.mean-last.mean;
+    double standardError = sqrt(first.getVariance()/firstBatches + last.getVariance()/lastBatches);
+    if (standardError == 0)
+        return difference == 0 ? 0 : std::copysign(INFINITY, difference);
+    return difference/standardError;
+}
+
+std::pair<Moments, Moments> StreamingBatchMeans::getSplitHalves() const {
+    size_t halfBatches = batches.size()/2;
+    return {mergeBatches(batches.begin(), batches.begin()+halfBatches),
+            mergeBatches(batches.end()-halfBatches, batches.end())};
+}
+
+static void writeMoments(std::ostream& stream, const Moments& moments) {
+    writeBinaryValue(stream, moments.count);
+    writeBinaryValue(stream, moments.mean);
+    writeBinaryValue(stream, moments.squaredDeviations);
+}
+
+static void readMoments(std::istream& stream, Moments& moments) {
+    readBinaryValue(stream, moments.count);
+    readBinaryValue(stream, moments.mean);
+    readBinaryValue(stream, moments.squaredDeviations);
+}
+
+void StreamingBatchMeans::writeState(std::ostream& stream) const {
+    writeBinaryValue(stream, batchSize);
+    writeMoments(stream, currentBatch);
+    writeBinaryValue(stream, batches.size());
+    for (auto& batch: batches)
+        writeMoments(stream, batch);
+}
+
+void StreamingBatchMeans::readState(std::istream& stream) {
+    size_t batchNumber = 0;
+    readBinaryValue(stream, batchSize);
+    readMoments(stream, currentBatch);
+    readBinaryValue(stream, batchNumber);
+    if (!stream || batchSize == 0 || batchNumber >= BATCH_NUMBER || currentBatch.count >= batchSize)
+        throw std::runtime_error("StreamingBatchMeans: the state is truncated or corrupted.");
+
+    batches.resize(batchNumber);
+    for (auto& batch: batches)
+        readMoments(stream, batch);
+}
+
+
+double getSplitRHat(const std::vector<const StreamingBatchMeans*>& chains) {
+    Moments halfMeans;
+    double withinVariance = 0, halfLength = 0;
+
+    for (auto chain: chains) {
+        if (!chain->hasEnoughSamples())
+            continue;
+        auto halves = chain->getSplitHalves();
+        for (auto& half: {halves.first, halves.second}) {
+            halfMeans.add(half.mean);
+            withinVariance += half.getVariance();
+            halfLength += half.count;
+        }
+    }
+    if (halfMeans.count == 0)
+        return NaN;
+
+    withinVariance /= halfMeans.count;
+    halfLength /= halfMeans.count;
+    double betweenVariance = halfMeans.getVariance();  // B/n in Gelman et al.
+
+    if (withinVariance == 0)
+        return betweenVariance == 0 ? 1 : INFINITY;
+    return sqrt(((halfLength-1)/halfLength*withinVariance + betweenVariance)/withinVariance);
+}
+
+
+static std::string getQuantityName(size_t quantity) {
+    switch (quantity) {
+        case 0: return "log-likelihood";
+        case 1: return "edges";
+        case 2: return "triangles";
+        default: return "parameter "+std::to_string(quantity-3);
+    }
+}
+
+void ConvergenceMonitor::resetChain(size_t chain) {
+    std::lock_guard<std::mutex> lock(mutex);
+    chainQuantities.erase(chain);
+}
+
+void ConvergenceMonitor::record(size_t chain, double logLikelihood, const Hypergraph& hypergraph, const Parameters& parameters) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& quantities = chainQuantities[chain];
+    if (quantities.empty())
+        quantities.resize(3+parameters.size());
+    else if (quantities.size() != 3+parameters.size())
+        throw std::logic_error("ConvergenceMonitor: The number of parameters changed during the chain.");
+
+    quantities[0].push(logLikelihood);
+    quantities[1].push(hypergraph.getEdgeNumber());
+    quantities[2].push(hypergraph.getTriangleNumber());
+    for (size_t i=0; i<parameters.size(); i++)
+        quantities[3+i].push(parameters[i]);
+}
+
+// A chain that didn't record any sample is written without series
+void ConvergenceMonitor::writeChainState(size_t chain, std::ostream& stream) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto chainIt = chainQuantities.find(chain);
+    size_t quantityNumber = chainIt == chainQuantities.end() ? 0 : chainIt->second.size();
+
+    writeBinaryValue(stream, quantityNumber);
+    for (size_t i=0; i<quantityNumber; i++)
+        chainIt->second[i].writeState(stream);
+}
+
+void ConvergenceMonitor::readChainState(size_t chain, std::istream& stream) {
+    size_t quantityNumber = 0;
+    readBinaryValue(stream, quantityNumber);
+    if (!stream || quantityNumber > 1<<16)
+        throw std::runtime_error("ConvergenceMonitor: the chain state is truncated or corrupted.");
+
+    std::vector<StreamingBatchMeans> quantities(quantityNumber);
+    for (auto& series: quantities)
+        series.readState(stream);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (quantities.empty())
+        chainQuantities.erase(chain);
+    else
+        chainQuantities[chain] = std::move(quantities);
+}
+
+std::vector<QuantityDiagnostics> ConvergenceMonitor::getDiagnostics(size_t chain) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return computeDiagnostics(chain);
+}
+
+bool ConvergenceMonitor::hasConverged(size_t chain) const {
+    if (!targets.any())
+        return false;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto diagnostics = computeDiagnostics(chain);
+    if (diagnostics.empty())
+        return false;
+
+    // Comparisons with NaN are false
+    for (auto& quantity: diagnostics)
+        if ((targets.minimumEffectiveSampleSize > 0 && !(quantity.effectiveSampleSize >= targets.minimumEffectiveSampleSize))
+                || (targets.maximumGewekeZScore > 0 && !(fabs(quantity.gewekeZScore) <= targets.maximumGewekeZScore))
+                || (targets.maximumSplitRHat > 0 && !(quantity.splitRHat <= targets.maximumSplitRHat)))
+            return false;
+    return true;
+}
+
+std::vector<QuantityDiagnostics> ConvergenceMonitor::computeDiagnostics(size_t chain) const {
+    std::vector<QuantityDiagnostics> diagnostics;
+    auto chainIt = chainQuantities.find(chain);
+    if (chainIt == chainQuantities.end())
+        return diagnostics;
+
+    auto& quantities = chainIt->second;
+    for (size_t i=0; i<quantities.size(); i++) {
+        std::vector<const StreamingBatchMeans*> chains;
+        for (auto& otherChain: chainQuantities)
+            if (otherChain.second.size() == quantities.size())
+                chains.push_back(&otherChain.second[i]);
+
+        auto& series = quantities[i];
+        diagnostics.push_back({getQuantityName(i), series.getSampleNumber(), series.getMoments().mean,
+                series.getEffectiveSampleSize(), series.getGewekeZScore(), series.hasEnoughSamples() ? getSplitRHat(chains) : NaN});
+    }
+    return diagnostics;
+}
+
+} //namespace GRIT
@@ -1,4 +1,7 @@
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <fstream>
 #include <random>
 #include <sstream>
@@ -10,9 +13,55 @@
 namespace GRIT {
 
 
-void GibbsBase::writeStateToFile(size_t iteration) const {
-    writeGraphStateToBinary(iteration);
-    writeParametersStateToBinary(iteration);
+GibbsBase::~GibbsBase() {
+    try {
+        flushSamples();
+    }
+    catch (const std::exception& error) {
+        fprintf(stderr, "Error while writing samples: %s\n", error.what());
+    }
+}
+
+void GibbsBase::writeStateToFile(size_t iteration) {
+    if (!sampleWriter)
+        sampleWriter = std::make_unique<AsyncSampleWriter>(sampleQueueCapacity);
+
+    std::stringstream hypergraphFileName, parametersFileName;
+    hypergraphFileName << hypergraphSampleDirectory << hypergraphSamplePrefix << chainID << '_' << iteration << ".bin";
+    parametersFileName << parameterSampleDirectory << parametersSamplePrefix << chainID << '_' << iteration << ".bin";
+
+    sampleWriter->push({HypergraphSnapshot(hypergraph), parameters, hypergraphFileName.str(), parametersFileName.str(), sampleFormat});
+}
+
+bool GibbsBase::streamSample(size_t iteration) const {
+    if (!sampleSink)
+        return false;
+    return sampleSink({chainID, iteration, std::make_shared<const Hypergraph>(hypergraph), parameters});
+}
+
+bool GibbsBase::monitorConvergence(size_t iteration) const {
+    if (!convergenceMonitor)
+        return false;
+
+    convergenceMonitor->record(chainID, getCurrentLogLikelihood(), hypergraph, parameters);
+    if (!convergenceMonitor->hasConverged(chainID))
+        return false;
+
+    if (verbose > 0) {
+        printf("Chain %lu converged after %lu samples\n", chainID+1, iteration+1);
+        fflush(stdout);
+    }
+    return true;
+}
+
+void GibbsBase::resetConvergenceMonitor() const {
+    if (convergenceMonitor)
+        convergenceMonitor->resetChain(chainID);
+}
+
+void GibbsBase::flushSamples() {
+    if (sampleWriter)
+        sampleWriter->flush();
 }
 
 void GibbsBase::writeGraphStateToBinary(size_t iteration) const {
@@ -32,15 +81,19 @@ void GibbsBase::writeParametersStateToBinary(size_t iteration) const {
 void GibbsBase::sample(size_t sampleSize, size_t burnin) {
 
     resetValues();
+    resetConvergenceMonitor();
     outputProgressToConsole(0, sampleSize, burnin);
     for (size_t i=0; i<sampleSize+burnin; i++) {
-
+        updateMoveAdaptation(i, burnin);
         sampleFromPosterior();
         if (i >= burnin) {
             writeStateToFile(i-burnin);
+            if (streamSample(i-burnin) || monitorConvergence(i-burnin))
+                break;
         }
         outputProgressToConsole(i+1, sampleSize, burnin);
     }
+    flushSamples();
 }
 
 static void updateParametersAverage(const GRIT::Parameters& sampleParameters, GRIT::Parameters& averageParameters, size_t chainSize) {
@@ -53,48 +106,281 @@ static void updateParametersAverage(const GRIT::Parameters& sampleParameters, GR
 
 RandomVariables GibbsBase::sampleAndGetAverage(size_t sampleSize, size_t burnin, bool correlation, bool writeSamplesToFile) {
     resetValues();
+    resetConvergenceMonitor();
     outputProgressToConsole(0, sampleSize, burnin);
 
     // No edge (type 0) is deduced from the others.
     EdgeTypeFrequencies edgetype1(hypergraph.getSize());
     EdgeTypeFrequencies edgetype2(hypergraph.getSize());
     Parameters averageParameters;
+    size_t sampleNumber = 0;
 
     for (size_t i=0; i<sampleSize+burnin; i++) {
+        updateMoveAdaptation(i, burnin);
         sampleFromPosterior();
 
         if (i >= burnin) {
+            sampleNumber++;
             updateTypesProportions(edgetype1, edgetype2, correlation);
-            updateParametersAverage(parameters, averageParameters, i-burnin+1);
+            updateParametersAverage(parameters, averageParameters, sampleNumber);
 
             if (writeSamplesToFile)
                 writeStateToFile(i-burnin);
+            if (streamSample(i-burnin) || monitorConvergence(i-burnin))
+                break;
         }
         outputProgressToConsole(i+1, sampleSize, burnin);
     }
-    return {getMostCommonEdgeTypes(edgetype1, edgetype2, sampleSize), averageParameters};
+    flushSamples();
+    return {getMostCommonEdgeTypes(edgetype1, edgetype2, sampleNumber), averageParameters};
 }
 
 std::pair<EdgeTypeFrequencies, EdgeTypeFrequencies> GibbsBase::sampleAndGetOccurences(size_t sampleSize, size_t burnin, bool correlation, bool writeSamplesToFile) {
     resetValues();
-    outputProgressToConsole(0, sampleSize, burnin);
+    resetConvergenceMonitor();
 
     // No edge (type 0) is deduced from the others.
     EdgeTypeFrequencies edgetype1(hypergraph.getSize());
     EdgeTypeFrequencies edgetype2(hypergraph.getSize());
 
-    for (size_t i=0; i<sampleSize+burnin; i++) {
+    continueAndGetOccurences(0, sampleSize, burnin, correlation, writeSamplesToFile, edgetype1, edgetype2);
+    return {edgetype1, edgetype2};
+}
+
+std::pair<EdgeTypeFrequencies, EdgeTypeFrequencies> GibbsBase::resumeAndGetOccurences(size_t sampleSize, size_t burnin, bool correlation, bool writeSamplesToFile) {
+    resetValues();
+
+    EdgeTypeFrequencies edgetype1(hypergraph.getSize());
+    EdgeTypeFrequencies edgetype2(hypergraph.getSize());
+    size_t firstIteration = readCheckpoint(sampleSize, burnin, edgetype1, edgetype2);
+
+    continueAndGetOccurences(firstIteration, sampleSize, burnin, correlation, writeSamplesToFile, edgetype1, edgetype2);
+    return {edgetype1, edgetype2};
+}
+
+void GibbsBase::continueAndGetOccurences(size_t firstIteration, size_t sampleSize, size_t burnin, bool correlation, bool writeSamplesToFile,
+        EdgeTypeFrequencies& edgetype1, EdgeTypeFrequencies& edgetype2) {
+    occurencesSampleNumber = firstIteration > burnin ? firstIteration-burnin : 0;
+    outputProgressToConsole(firstIteration, sampleSize, burnin);
+
+    for (size_t i=firstIteration; i<sampleSize+burnin; i++) {
+        updateMoveAdaptation(i, burnin);
+        if (occupancyAccumulator && i == burnin)  // A resumed chain restores the accumulator from the checkpoint
+            occupancyAccumulator->start();
         sampleFromPosterior();
 
         if (i >= burnin) {
             updateTypesProportions(edgetype1, edgetype2, correlation);
+            occurencesSampleNumber++;
 
             if (writeSamplesToFile)
                 writeStateToFile(i-burnin);
+            if (streamSample(i-burnin) || monitorConvergence(i-burnin))
+                break;
         }
+        bool writingCheckpoint = checkpointInterval > 0 && (i+1)%checkpointInterval == 0 && i+1 < sampleSize+burnin;
+        if (writingCheckpoint || (canonicalizationInterval > 0 && (i+1)%canonicalizationInterval == 0))
+            canonicalizeState();
+        if (writingCheckpoint)
+            writeCheckpoint(i+1, sampleSize, burnin, edgetype1, edgetype2);
+
         outputProgressToConsole(i+1, sampleSize, burnin);
     }
-    return {edgetype1, edgetype2};
+    flushSamples();
+}
+
+static const char checkpointMagic[8] = {'G', 'R', 'I', 'T', 'C', 'K', 'P', '\0'};
+static const uint32_t checkpointVersion = 1;
+
+static void writeOccurences(std::ostream& stream, const EdgeTypeFrequencies& edgetype) {
+    size_t entryNumber = 0;
+    for (auto& row: edgetype)
+        entryNumber += row.size();
+
+    writeBinaryValue(stream, entryNumber);
+    for (size_t i=0; i<edgetype.size(); i++)
+        for (auto& j_count: edgetype[i]) {
+            writeBinaryValue(stream, i);
+            writeBinaryValue(stream, j_count.first);
+            writeBinaryValue(stream, j_count.second);
+        }
+}
+
+static void readOccurences(std::istream& stream, EdgeTypeFrequencies& edgetype) {
+    size_t entryNumber, i, j, count;
+    readBinaryValue(stream, entryNumber);
+    for (size_t n=0; n<entryNumber && stream; n++) {
+        readBinaryValue(stream, i);
+        readBinaryValue(stream, j);
+        readBinaryValue(stream, count);
+        if (i >= edgetype.size() || j >= edgetype.size())
+            throw std::runtime_error("Checkpoint: edge type occurence is out of range.");
+        edgetype[i][j] = count;
+    }
+}
+
+template<typename T>
+static void writeVector(std::ostream& stream, const std::vector<T>& values) {
+    writeBinaryValue(stream, values.size());
+    stream.write((const char*) values.data(), values.size()*sizeof(T));
+}
+
+template<typename T>
+static std::vector<T> readVector(std::istream& stream, size_t maximumSize) {
+    size_t valueNumber = 0;
+    readBinaryValue(stream, valueNumber);
+    if (!stream || valueNumber > maximumSize)
+        throw std::runtime_error("Checkpoint: file is truncated or corrupted.");
+
+    std::vector<T> values(valueNumber);
+    stream.read((char*) values.data(), valueNumber*sizeof(T));
+    return values;
+}
+
+static void getSortedHyperedges(const Hypergraph& hypergraph, std::vector<Index>& edges, std::vector<Index>& triangles) {
+    HypergraphSnapshot snapshot(hypergraph);
+    std::sort(snapshot.edges.begin(), snapshot.edges.end());
+    edges.clear();
+    edges.reserve(3*snapshot.edges.size());
+    for (auto& edge: snapshot.edges)
+        edges.insert(edges.end(), edge.begin(), edge.end());
+
+    std::vector<std::array<Index, 3>> sortedTriangles;
+    sortedTriangles.reserve(snapshot.triangles.size());
+    for (auto& triangle: snapshot.triangles)
+        sortedTriangles.push_back({triangle.i, triangle.j, triangle.k});
+    std::sort(sortedTriangles.begin(), sortedTriangles.end());
+    triangles.clear();
+    triangles.reserve(3*sortedTriangles.size());
+    for (auto& triangle: sortedTriangles)
+        triangles.insert(triangles.end(), triangle.begin(), triangle.end());
+}
+
+// Rebuilding from sorted hyperedges gives the containers the same state as after resuming from a checkpoint
+void GibbsBase::canonicalizeState() {
+    std::vector<Index> edges, triangles;
+    getSortedHyperedges(hypergraph, edges, triangles);
+    restoreHypergraph(hypergraph.getSize(), edges, triangles);
+    recomputeDistributions();
+}
+
+// The state is written as is: the loop canonicalizes it before every checkpoint
+void GibbsBase::writeCheckpoint(size_t nextIteration, size_t sampleSize, size_t burnin,
+        const EdgeTypeFrequencies& edgetype1, const EdgeTypeFrequencies& edgetype2) {
+    flushSamples();
+
+    std::vector<Index> edges, triangles;
+    getSortedHyperedges(hypergraph, edges, triangles);
+
+    std::string temporaryFileName = checkpointFileName+".tmp";
+    std::ofstream fileStream(temporaryFileName, std::ios::out|std::ios::binary);
+    if (!fileStream.is_open()) throw std::runtime_error("The file \""+temporaryFileName+"\" could not be open to write the checkpoint.");
+
+    fileStream.write(checkpointMagic, sizeof(checkpointMagic));
+    writeBinaryValue(fileStream, checkpointVersion);
+    writeBinaryValue(fileStream, chainID);
+    writeBinaryValue(fileStream, nextIteration);
+    writeBinaryValue(fileStream, sampleSize);
+    writeBinaryValue(fileStream, burnin);
+
+    std::stringstream generatorState;
+    generatorState << generator;
+    std::string generatorStateString = generatorState.str();
+    writeVector(fileStream, std::vector<char>(generatorStateString.begin(), generatorStateString.end()));
+
+    writeVector(fileStream, parameters);
+    writeBinaryValue(fileStream, hypergraph.getSize());
+    writeVector(fileStream, edges);
+    writeVector(fileStream, triangles);
+    writeOccurences(fileStream, edgetype1);
+    writeOccurences(fileStream, edgetype2);
+    writeBinaryValue(fileStream, (bool) convergenceMonitor);
+    if (convergenceMonitor)
+        convergenceMonitor->writeChainState(chainID, fileStream);
+    writeBinaryValue(fileStream, occupancyAccumulator != nullptr);
+    if (occupancyAccumulator)
+        occupancyAccumulator->writeState(fileStream);
+    writeSamplerState(fileStream);
+
+    fileStream.close();
+    if (!fileStream)
+        throw std::runtime_error("Error while writing the checkpoint \""+temporaryFileName+"\".");
+    if (std::rename(temporaryFileName.c_str(), checkpointFileName.c_str()) != 0)
+        throw std::runtime_error("The checkpoint \""+temporaryFileName+"\" could not be moved to \""+checkpointFileName+"\".");
+}
+
+size_t GibbsBase::readCheckpoint(size_t sampleSize, size_t burnin, EdgeTypeFrequencies& edgetype1, EdgeTypeFrequencies& edgetype2) {
+    std::ifstream fileStream(checkpointFileName, std::ios::in|std::ios::binary);
+    if (!fileStream.is_open()) throw std::runtime_error("The file \""+checkpointFileName+"\" could not be open to read the checkpoint.");
+
+    char magic[sizeof(checkpointMagic)];
+    uint32_t version = 0;
+    fileStream.read(magic, sizeof(magic));
+    readBinaryValue(fileStream, version);
+    if (!fileStream || !std::equal(magic, magic+sizeof(magic), checkpointMagic))
+        throw std::runtime_error("The file \""+checkpointFileName+"\" isn't a GRIT checkpoint.");
+    if (version != checkpointVersion)
+        throw std::runtime_error("The checkpoint \""+checkpointFileName+"\" has an unsupported version ("+std::to_string(version)+").");
+
+    size_t fileChainID, nextIteration, fileSampleSize, fileBurnin;
+    readBinaryValue(fileStream, fileChainID);
+    readBinaryValue(fileStream, nextIteration);
+    readBinaryValue(fileStream, fileSampleSize);
+    readBinaryValue(fileStream, fileBurnin);
+    if (fileChainID != chainID || fileSampleSize != sampleSize || fileBurnin != burnin)
+        throw std::runtime_error("The checkpoint \""+checkpointFileName+"\" was written for another chain, sample size or burn-in.");
+
+    auto generatorStateString = readVector<char>(fileStream, 1<<16);
+    std::stringstream generatorState(std::string(generatorStateString.begin(), generatorStateString.end()));
+    std::mt19937 restoredGenerator;
+    if (!(generatorState >> restoredGenerator))
+        throw std::runtime_error("Checkpoint: the random number generator state is invalid.");
+
+    auto restoredParameters = readVector<double>(fileStream, parameters.size());
+    size_t size = 0;
+    readBinaryValue(fileStream, size);
+    if (size != hypergraph.getSize() || restoredParameters.size() != parameters.size())
+        throw std::runtime_error("The checkpoint \""+checkpointFileName+"\" doesn't have the same number of vertices or parameters as the chain.");
+
+    auto edges = readVector<Index>(fileStream, 3*nchoose2(size));
+    auto triangles = readVector<Index>(fileStream, 3*nchoose3(size));
+    readOccurences(fileStream, edgetype1);
+    readOccurences(fileStream, edgetype2);
+    bool hasMonitorState = false;
+    readBinaryValue(fileStream, hasMonitorState);
+    if (hasMonitorState) {
+        ConvergenceMonitor ignoredMonitor;  // Read anyway to reach the sampler state
+        (convergenceMonitor ? *convergenceMonitor : ignoredMonitor).readChainState(chainID, fileStream);
+    }
+    else
+        resetConvergenceMonitor();
+    bool hasOccupancyState = false;
+    readBinaryValue(fileStream, hasOccupancyState);
+    if (hasOccupancyState) {
+        OccupancyAccumulator ignoredAccumulator(hypergraph, true);
+        (occupancyAccumulator ? *occupancyAccumulator : ignoredAccumulator).readState(fileStream);
+    }
+    readSamplerState(fileStream);
+    if (!fileStream)
+        throw std::runtime_error("Checkpoint: file \""+checkpointFileName+"\" is truncated.");
+    if (edges.size()%3 != 0 || triangles.size()%3 != 0 || nextIteration > sampleSize+burnin)
+        throw std::runtime_error("Checkpoint: file \""+checkpointFileName+"\" is corrupted.");
+
+    generator = restoredGenerator;
+    parameters = restoredParameters;
+    restoreHypergraph(size, edges, triangles);
+    recomputeDistributions();
+    if (occupancyAccumulator && !hasOccupancyState && nextIteration > burnin)
+        occupancyAccumulator->start();  // The steps before the checkpoint weren't accumulated
+
+    return nextIteration;
+}
+
+void GibbsBase::restoreHypergraph(size_t size, const std::vector<Index>& edges, const std::vector<Index>& triangles) {
+    Hypergraph restoredHypergraph(size);
+    restoredHypergraph.addSortedEdges(edges.data(), edges.size()/3);
+    restoredHypergraph.addSortedTriangles(triangles.data(), triangles.size()/3);
+    hypergraph = std::move(restoredHypergraph);
 }
 
 void GibbsBase::updateTypesProportions(EdgeTypeFrequencies& edgetype1, EdgeTypeFrequencies& edgetype2, bool correlation) const {
@@ -180,6 +466,24 @@ Hypergraph GibbsBase::getMostCommonEdgeTypes(EdgeTypeFrequencies& edgetype1, Edg
     return mostCommonEdgeTypes;
 }
 
+void GibbsBase::updateMoveAdaptation(size_t iteration, size_t burnin) {
+    bool adapt = adaptiveMoves && iteration < burnin;
+    if (adapt == adaptingMoves)
+        return;
+
+    setMoveAdaptation(adapt);
+    adaptingMoves = adapt;
+
+    if (!adapt && verbose > 0) {
+        auto moveParameters = getMoveParameters();
+        printf("Chain %lu adapted moves: eta=%.2f, move probabilities=[", chainID+1, moveParameters.eta);
+        for (size_t i=0; i<moveParameters.moveProbabilities.size(); i++)
+            printf(i == 0 ? "%.4f" : ", %.4f", moveParameters.moveProbabilities[i]);
+        printf("]\n");
+        fflush(stdout);
+    }
+}
+
 static size_t getPercentProgress(size_t i, size_t n) {
     return (i*100)/n;
 }
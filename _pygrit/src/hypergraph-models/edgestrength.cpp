@@ -4,10 +4,18 @@
 namespace GRIT{
 
 
-double EdgeStrengthGraphModel::operator()(const TwoStepsEdgeProposal &proposal) const {
+void EdgeStrengthGraphModel::updateParameterCache() {
     const double& q1 = parameters[q1Index];
     const double& q2 = parameters[q2Index];
 
+    addedEdgeLogRatios[0] = log(q1) - log(1-q1);
+    addedEdgeLogRatios[1] = log(q2) - log(1-q2) - log(q1);
+    removedEdgeLogRatios[0] = log(1-q1) - log(q1);
+    removedEdgeLogRatios[1] = log(1-q2) + log(q1) - log(q2);
+}
+
+double EdgeStrengthGraphModel::operator()(const TwoStepsEdgeProposal &proposal) const {
+
     size_t m = hypergraph.getEdgeMultiplicity(
             proposal.chosenEdge.first,
             proposal.chosenEdge.second
@@ -16,18 +24,14 @@ double EdgeStrengthGraphModel::operator()(const TwoStepsEdgeProposal &proposal)
     double logLikelihood = 0;
 
     if (proposal.move == ADD) {
-        if (m == 0)
-            logLikelihood += log(q1) - log(1-q1);
-        else if (m == 1)
-            logLikelihood += log(q2) - log(1-q2) - log(q1);
+        if (m < 2)
+            logLikelihood += addedEdgeLogRatios[m];
         else
             throw std::logic_error("Graph model: Cannot add edge of multiplicity 2.");
     }
     else {
-        if (m == 1)
-            logLikelihood += log(1-q1) - log(q1);
-        else if (m == 2)
-            logLikelihood += log(1-q2) + log(q1) - log(q2);
+        if (m == 1 || m == 2)
+            logLikelihood += removedEdgeLogRatios[m-1];
         else if (m == 0)
             throw std::logic_error("Graph model: Cannot remove edge of multiplicity 0.");
     }
@@ -5,12 +5,10 @@ namespace GRIT{
 
 
 double GilbertGraphModel::operator()(const TwoStepsEdgeProposal &proposal) const {
-    const double& q = parameters[qIndex];
-
     if (proposal.move == ADD)
-        return log(q) - log(1-q);
+        return addedEdgeLogOdds;
     else
-        return log(1-q) - log(q);
+        return removedEdgeLogOdds;
 }
 
 } //namespace GRIT
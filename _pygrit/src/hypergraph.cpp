@@ -1,4 +1,5 @@
 #include <math.h>
+#include <algorithm>
 #include <fstream>
 #include <map>
 #include <iostream>
@@ -6,6 +7,7 @@
 #include <boost/filesystem.hpp>
 
 #include "GRIT/hypergraph.h"
+#include "GRIT/compact_format.h"
 #include "GRIT/utility.h"
 
 
@@ -100,6 +102,37 @@ bool Hypergraph::removeEdge(c_Index& vertex1, c_Index& vertex2) {
     return true;
 }
 
+std::vector<std::pair<Index, size_t>> Hypergraph::getHigherNeighbourTypes(c_Index& vertex, bool highestOrder) const {
+    if (vertex >= size) throw logic_error("Getting neighbour types: vertex out of range");
+
+    std::vector<std::pair<Index, size_t>> neighbourTypes;
+    for (auto& neighbour: adjacencyLists[vertex])
+        if (neighbour.first > vertex && neighbour.second > 0)
+            neighbourTypes.push_back({neighbour.first, highestOrder ? 1 : neighbour.second});
+
+    if (!highestOrder) {
+        std::sort(neighbourTypes.begin(), neighbourTypes.end());
+        return neighbourTypes;
+    }
+
+    for (auto& triangleNeighbours: getTrianglesFrom(vertex)) {
+        if (triangleNeighbours.first > vertex)
+            neighbourTypes.push_back({triangleNeighbours.first, 2});
+        for (auto k: triangleNeighbours.second)
+            if (k > vertex)
+                neighbourTypes.push_back({k, 2});
+    }
+    // A pair covered by a triangle keeps type 2
+    std::sort(neighbourTypes.begin(), neighbourTypes.end(),
+            [](const std::pair<Index, size_t>& a, const std::pair<Index, size_t>& b) {
+                return a.first < b.first || (a.first == b.first && a.second > b.second);
+            });
+    neighbourTypes.erase(std::unique(neighbourTypes.begin(), neighbourTypes.end(),
+                [](const std::pair<Index, size_t>& a, const std::pair<Index, size_t>& b) { return a.first == b.first; }),
+            neighbourTypes.end());
+    return neighbourTypes;
+}
+
 size_t Hypergraph::getHighestOrderHyperedgeWith(c_Index& vertex1, c_Index& vertex2) const {
     if (vertex1 >= size || vertex2 >= size) throw logic_error("Getting highest order hyperedge: vertex out of range");
 
@@ -145,6 +178,35 @@ size_t Hypergraph::getHighestOrderHyperedgeExcluding(c_Index& vertex1, c_Index&
     return highestOrder;
 }
 
+std::array<size_t, 3> Hypergraph::getTripletPairsHighestOrder(const Triplet& orderedTriplet, bool excludeTriplet) const {
+    const Index& i = orderedTriplet.i;
+    const Index& j = orderedTriplet.j;
+    const Index& k = orderedTriplet.k;
+    if (k >= size) throw logic_error("Getting highest order hyperedges of triplet: vertex out of range");
+
+    auto covered = getTripletPairsCoverage(orderedTriplet, excludeTriplet);
+    std::array<size_t, 3> highestOrders {2, 2, 2};
+
+    // The adjacency of i is scanned once for both of its pairs
+    if (!covered[0] || !covered[1]) {
+        bool isEdge_ij = false, isEdge_ik = false;
+        for (auto& neighbour_multiplicity_pair: adjacencyLists[i]) {
+            isEdge_ij = isEdge_ij || neighbour_multiplicity_pair.first == j;
+            isEdge_ik = isEdge_ik || neighbour_multiplicity_pair.first == k;
+            if (isEdge_ij && isEdge_ik)
+                break;
+        }
+        if (!covered[0])
+            highestOrders[0] = isEdge_ij;
+        if (!covered[1])
+            highestOrders[1] = isEdge_ik;
+    }
+    if (!covered[2])
+        highestOrders[2] = isEdge(j, k);
+
+    return highestOrders;
+}
+
 size_t Hypergraph::getEdgeMultiplicity(c_Index& vertex1, c_Index& vertex2) const {
     if (vertex1 >= size || vertex2 >= size) throw logic_error("Getting edge multiplicity: vertex out of range");
 
@@ -183,6 +245,26 @@ void Hypergraph::writeEdgesToBinary(const std::string &fileName) const {
     }
 }
 
+void Hypergraph::writeToCompactBinary(const std::string& fileName, bool compress) const {
+    vector<CompactTriplet> edges, triangles;
+    edges.reserve(edgeNumber);
+    triangles.reserve(triangleNumber);
+
+    for (Index i=0; i<size; i++) {
+        for (auto& neighbour_multiplicity_pair: adjacencyLists[i])
+            if (i < neighbour_multiplicity_pair.first)
+                edges.push_back({(uint32_t) i, (uint32_t) neighbour_multiplicity_pair.first, (uint32_t) neighbour_multiplicity_pair.second});
+
+        for (auto& triangleNeighbours: getTrianglesFrom(i)) {
+            auto& j = triangleNeighbours.first;
+            if (i < j)
+                for (auto& k: triangleNeighbours.second)
+                    triangles.push_back({(uint32_t) i, (uint32_t) j, (uint32_t) k});
+        }
+    }
+    writeCompactHypergraph(fileName, size, std::move(edges), std::move(triangles), compress);
+}
+
 void Hypergraph::writeToCSV(const std::string &fileName) const {
     ofstream fileStream(fileName.c_str());
     if (!fileStream.is_open()) throw runtime_error("The file \""+fileName+"\" could not be open to write the hypergraph.");
@@ -214,8 +296,11 @@ Hypergraph Hypergraph::loadFromBinary(const std::string& filePrefix) {
     bool hypergraphHasEdges = edgeFileStream.is_open();
     bool hypergraphHasTriangles = triangleFileStream.is_open();
 
-    if (!hypergraphHasTriangles && !hypergraphHasEdges)
+    if (!hypergraphHasTriangles && !hypergraphHasEdges) {
+        if (CompactHypergraphFile::isCompactHypergraph(filePrefix))
+            return loadFromCompactBinary(filePrefix);
         throw logic_error("Hypergraph: no data file found using " + filePrefix);
+    }
 
     TriangleList __triangleList(3);
     if (hypergraphHasTriangles)
@@ -252,6 +337,10 @@ Hypergraph Hypergraph::loadFromBinary(const std::string& filePrefix) {
     return returnedGraph;
 }
 
+Hypergraph Hypergraph::loadFromCompactBinary(const std::string& fileName) {
+    return CompactHypergraphFile(fileName).toHypergraph();
+}
+
 const list<Triplet> Hypergraph::getFullTriangleList() const{
     list<Triplet> fullTriangleList;
 
@@ -0,0 +1,603 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <list>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+#include "GRIT/hypergraph_generation.h"
+#include "GRIT/parallel.h"
+
+
+namespace GRIT {
+
+template<typename T>
+static bool areAllDifferent(const std::vector<T>& elements);
+static inline size_t choose2(size_t n);
+static void addEdgesWithProbability(Hypergraph&, double p);
+static void decodeCombination(size_t rank, size_t k, size_t first, size_t* vertices);
+static std::vector<size_t> getSortedHyperedges(std::vector<std::vector<std::array<size_t, 3>>>& hyperedges);
+
+
+Hypergraph generateIndependentLayeredEdges(size_t n, double q1, double q2) {
+    Hypergraph hypergraph(n);
+
+    addEdgesWithProbability(hypergraph, q1);
+
+    size_t i=0;
+    size_t j=0;
+
+    std::uniform_real_distribution<double> distribution(0, 1);
+    double r;
+
+    while (i<n) {
+        r = distribution(generator);
+        j += 1+floor(log(1-r)/log(1-q2));
+        while (j >= i && i < n) {
+            j -= i;
+            i++;
+        }
+        if (i<n) {
+            if (hypergraph.isEdge(i, j))
+                hypergraph.addEdge(i, j);
+            else
+                hypergraph.addMultiedge(i, j, 2);
+        }
+    }
+    return hypergraph;
+}
+
+Hypergraph generateIndependentTriangleHypergraph(size_t n, double p){
+    Hypergraph hypergraph(n);
+    size_t i(0), j(1), k(2);
+    size_t cumulativeI(0), cumulativeJ(0);
+    size_t idx = 0;
+    bool firstDraw = true;
+
+    std::uniform_real_distribution<double> distribution(0, 1);
+    double r;
+    size_t nchoose3 = n*(n-1)*(n-2)/6;
+
+    while (true){
+        r = distribution(generator);
+        double skip = floor( log(1-r)/log(1-p) );
+        size_t first = firstDraw ? 0 : idx+1;
+        firstDraw = false;
+
+        if (skip >= nchoose3-first) break;
+        idx = first + (size_t) skip;
+
+        while (idx-cumulativeI >= choose2(n-i-1)) {
+            cumulativeJ = 0;
+            cumulativeI += choose2(n-i-1);
+            i++;
+            j = i+1;
+        }
+        while (idx-cumulativeI-cumulativeJ >= n-j-1){
+            cumulativeJ += n-j-1;
+            j += 1;
+        }
+        k = j+1 + idx-cumulativeJ-cumulativeI;
+        hypergraph.addTriangle({i, j, k});
+    }
+    return hypergraph;
+}
+
+Hypergraph generateIndependentHyperedgesHypergraph(size_t n, double p, double q) {
+    Hypergraph hypergraph = generateIndependentTriangleHypergraph(n, p);
+    addEdgesWithProbability(hypergraph, q);
+
+    return hypergraph;
+}
+
+// Adapted from https://stackoverflow.com/questions/38993415/how-to-apply-the-intersection-between-two-lists-in-c
+template<typename T>
+static std::list<T> intersectionOf(const std::list<T>& a, const std::list<T>& b){
+    std::list<T> rtn;
+    std::multiset<T> st;
+    std::for_each(a.begin(), a.end(), [&st](const T& k){ st.insert(k); });
+    std::for_each(b.begin(), b.end(),
+        [&st, &rtn](const T& k){
+            auto iter = st.find(k);
+            if(iter != st.end()){
+                rtn.push_back(k);
+                st.erase(iter);
+            }
+        }
+    );
+    return rtn;
+}
+
+Hypergraph generateIndependentHyperedgeOnlyCycles(size_t size, size_t subgraphSize, double triangleProbability) {
+    if (subgraphSize == 0)
+        throw std::logic_error("Complete graphs must have a non zero size.");
+    Hypergraph hypergraph(size);
+    std::bernoulli_distribution createTriangleDistribution(triangleProbability);
+
+    // Create disjoint subgraphs
+    for (size_t subgraph=0; subgraph<size/subgraphSize; subgraph++)
+        for (size_t i=subgraph*subgraphSize; i<(subgraph+1)*subgraphSize; i++)
+            for (size_t j=i; j<(subgraph+1)*subgraphSize; j++)
+                hypergraph.addEdge(i, j);
+
+
+    // Promote 3-cycles of edges to hyperedge with given probability
+    for (size_t vertex1=0; vertex1<size; vertex1++) {
+        auto& vertex1Neighbours = hypergraph.getEdgesFrom(vertex1);
+
+        for (auto vertex2: vertex1Neighbours)
+            if (vertex1 < vertex2.first)
+                for (auto vertex3: intersectionOf(vertex1Neighbours, hypergraph.getEdgesFrom(vertex2.first)))
+                    if (vertex2 < vertex3 && createTriangleDistribution(generator))
+                        hypergraph.addTriangle({vertex1, vertex2.first, vertex3.first});
+    }
+    return hypergraph;
+}
+
+Hypergraph generateIndependentHyperedgeWithoutCycles(size_t n, double triangleProbability, double edgeProbability){
+    Hypergraph hypergraph = generateIndependentTriangleHypergraph(n, triangleProbability);
+
+    size_t i=0;
+    size_t j=0;
+
+
+    std::uniform_real_distribution<double> distribution(0, 1);
+    double r;
+
+    while (i<n) {
+        r = distribution(generator);
+        j += 1+floor(log(1-r)/log(1-edgeProbability));
+        while (j >= i && i < n) {
+            j -= i;
+            i++;
+        }
+        if (i<n) {
+            bool edgeMakesCycle = false;
+
+            for (size_t k=0; k<n; k++) {
+                if (k == i || k == j)
+                    continue;
+
+                if (hypergraph.getHighestOrderHyperedgeWith(i, k) > 0 && hypergraph.getHighestOrderHyperedgeWith(j, k) > 0) {
+                    edgeMakesCycle = true;
+                    break;
+                }
+            }
+            if (!edgeMakesCycle)
+                hypergraph.addEdge(i, j);
+        }
+    }
+    return hypergraph;
+}
+
+// Edge propensities and triangle propensities, drawn alternately for each vertex
+static std::pair<std::vector<double>, std::vector<double>> drawNormalPropensities(size_t n, double edgeMean, double edgeSTD, double triangleMean, double triangleSTD) {
+    std::normal_distribution<double> edgePropensityDistribution(edgeMean, edgeSTD);
+    std::normal_distribution<double> trianglePropensitiesDistribution(triangleMean, triangleSTD);
+
+    std::vector<double> edgePropensities;
+    std::vector<double> trianglePropensities;
+    for (size_t i=0; i<n; i++){
+        edgePropensities.push_back(edgePropensityDistribution(generator));
+        trianglePropensities.push_back(trianglePropensitiesDistribution(generator));
+    }
+    return {edgePropensities, trianglePropensities};
+}
+
+Hypergraph generateBetaModelHypergraph(const std::vector<double>& edgePropensities, const std::vector<double>& trianglePropensities) {
+    if (edgePropensities.size() != trianglePropensities.size())
+        throw std::logic_error("There must be as many edge propensities as triangle propensities.");
+    size_t n = edgePropensities.size();
+    Hypergraph hypergraph(n);
+    std::uniform_real_distribution<double> uniform01Distribution(0, 1);
+
+    double edgeProbability, triangleProbability;
+
+    for (size_t i=0; i<n; i++) {
+        for (size_t j=i+1; j<n; j++) {
+            edgeProbability = (double) 1/(1+exp(-edgePropensities[i]-edgePropensities[j]));
+            if (uniform01Distribution(generator) <= edgeProbability)
+                hypergraph.addEdge(i, j);
+
+            for (size_t k=j+1; k<n; k++) {
+                triangleProbability = (double) 1/(1+exp(-trianglePropensities[i]-trianglePropensities[j]-trianglePropensities[k]));
+                if (uniform01Distribution(generator) <= triangleProbability)
+                    hypergraph.addTriangle({i, j, k});
+            }
+        }
+    }
+    return hypergraph;
+}
+
+Hypergraph generateBetaModelHypergraphWithNormalDistributions(size_t n, double edgeMean, double edgeSTD, double triangleMean, double triangleSTD) {
+    auto propensities = drawNormalPropensities(n, edgeMean, edgeSTD, triangleMean, triangleSTD);
+    return generateBetaModelHypergraph(propensities.first, propensities.second);
+}
+
+static inline double getLogistic(double x) {
+    return 1/(1+exp(-x));
+}
+
+static std::vector<size_t> getDecreasingOrder(const std::vector<double>& values) {
+    std::vector<size_t> order(values.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t i, size_t j) { return values[i] > values[j]; });
+    return order;
+}
+
+static std::vector<double> getSortedValues(const std::vector<double>& values, const std::vector<size_t>& order) {
+    std::vector<double> sortedValues;
+    sortedValues.reserve(order.size());
+    for (auto i: order)
+        sortedValues.push_back(values[i]);
+    return sortedValues;
+}
+
+// Draws the geometric number of failures before a success of probability p (infinite when p=0)
+static inline double drawGeometricSkip(double p, std::mt19937& generator, std::uniform_real_distribution<double>& distribution) {
+    if (p >= 1)
+        return 0;
+    return floor(log(1-distribution(generator))/log1p(-p));
+}
+
+// Edges {i, j>i} of the vertices sorted by decreasing propensity. Their probability decreases with j,
+// so the probability of the last candidate bounds the following ones.
+static void drawBetaModelEdgesFrom(size_t i, const std::vector<double>& propensities, const std::vector<size_t>& order,
+        std::mt19937& generator, std::vector<std::array<size_t, 3>>& edges) {
+    size_t n = propensities.size();
+    std::uniform_real_distribution<double> distribution(0, 1);
+
+    size_t j = i+1;
+    double bound = j < n ? getLogistic(propensities[i]+propensities[j]) : 0;
+    while (j < n) {
+        double skip = drawGeometricSkip(bound, generator, distribution);
+        if (skip >= n-j)
+            break;
+        j += skip;
+
+        double probability = getLogistic(propensities[i]+propensities[j]);
+        if (distribution(generator)*bound < probability)
+            edges.push_back({std::min(order[i], order[j]), std::max(order[i], order[j]), 1});
+        bound = probability;
+        j++;
+    }
+}
+
+// Triangles {i, j, k}, i<j<k, of the vertices sorted by decreasing propensity, visited in lexicographic
+// order of (j, k). The probability decreases with k in a row and the first entry of a row, (j, j+1),
+// bounds the rest of the index space. The bound after (j, k) is thus the largest of the probabilities
+// of (j, k) and (j+1, j+2), and skips cross rows in constant time.
+static void drawBetaModelTrianglesFrom(size_t i, const std::vector<double>& propensities, const std::vector<size_t>& order,
+        std::mt19937& generator, std::vector<std::array<size_t, 3>>& triangles) {
+    size_t n = propensities.size();
+    if (i+3 > n)
+        return;
+    std::uniform_real_distribution<double> distribution(0, 1);
+
+    auto getProbability = [&](size_t j, size_t k) { return getLogistic(propensities[i]+propensities[j]+propensities[k]); };
+    auto getRowBound = [&](size_t j) { return j+1 < n ? getProbability(j, j+1) : 0; };
+
+    // Lexicographic rank r of the pair (a, b) of {0, ..., m-1} is the reverse of the
+    // colexicographic rank of (m-1-b, m-1-a)
+    const size_t m = n-i-1;
+    const size_t pairNumber = choose2(m);
+    size_t rank = 0;
+    double bound = getRowBound(i+1);
+    size_t complement[2];
+
+    while (rank < pairNumber) {
+        double skip = drawGeometricSkip(bound, generator, distribution);
+        if (skip >= pairNumber-rank)
+            break;
+        rank += skip;
+
+        decodeCombination(pairNumber-1-rank, 2, 0, complement);
+        size_t j = i+1 + m-1-complement[1];
+        size_t k = i+1 + m-1-complement[0];
+
+        double probability = getProbability(j, k);
+        if (distribution(generator)*bound < probability) {
+            std::array<size_t, 3> triangle {order[i], order[j], order[k]};
+            std::sort(triangle.begin(), triangle.end());
+            triangles.push_back(triangle);
+        }
+        bound = std::max(probability, getRowBound(j+1));
+        rank++;
+    }
+}
+
+// Same distribution as generateBetaModelHypergraph in a time proportional to the number of hyperedges.
+// The hyperedges are drawn in parallel over their first vertex in the propensity order.
+Hypergraph generateBetaModelHypergraphBySkipping(const std::vector<double>& edgePropensities, const std::vector<double>& trianglePropensities, size_t threadNumber) {
+    if (edgePropensities.size() != trianglePropensities.size())
+        throw std::logic_error("There must be as many edge propensities as triangle propensities.");
+    size_t n = edgePropensities.size();
+
+    auto edgeOrder = getDecreasingOrder(edgePropensities);
+    auto triangleOrder = getDecreasingOrder(trianglePropensities);
+    auto sortedEdgePropensities = getSortedValues(edgePropensities, edgeOrder);
+    auto sortedTrianglePropensities = getSortedValues(trianglePropensities, triangleOrder);
+
+    // Consecutive first vertices share a random stream to amortize its seeding
+    const size_t verticesPerTask = 64;
+    const size_t taskNumber = (n+verticesPerTask-1)/verticesPerTask;
+
+    std::vector<std::vector<std::array<size_t, 3>>> edges(taskNumber), triangles(taskNumber);
+    TaskGenerators taskGenerators;
+    runInParallel(taskNumber, [&](size_t task) {
+        auto taskGenerator = taskGenerators.get(task);
+        for (size_t i=task*verticesPerTask; i<std::min(n, (task+1)*verticesPerTask); i++) {
+            drawBetaModelEdgesFrom(i, sortedEdgePropensities, edgeOrder, taskGenerator, edges[task]);
+            drawBetaModelTrianglesFrom(i, sortedTrianglePropensities, triangleOrder, taskGenerator, triangles[task]);
+        }
+    }, threadNumber);
+
+    Hypergraph hypergraph(n);
+    auto sortedEdges = getSortedHyperedges(edges);
+    hypergraph.addSortedEdges(sortedEdges.data(), sortedEdges.size()/3);
+    auto sortedTriangles = getSortedHyperedges(triangles);
+    hypergraph.addSortedTriangles(sortedTriangles.data(), sortedTriangles.size()/3);
+    return hypergraph;
+}
+
+Hypergraph generateBetaModelHypergraphBySkipping(size_t n, double edgeMean, double edgeSTD, double triangleMean, double triangleSTD, size_t threadNumber) {
+    auto propensities = drawNormalPropensities(n, edgeMean, edgeSTD, triangleMean, triangleSTD);
+    return generateBetaModelHypergraphBySkipping(propensities.first, propensities.second, threadNumber);
+}
+
+Hypergraph generateMillerConfigurationModelHypergraphWithGeometricDistribution(size_t n, double edgeProbability, double triangleProbability) {
+    Hypergraph hypergraph(n);
+
+    // Not using lists because of the required shuffling
+    std::vector<size_t> edgeStubs;
+    std::vector<size_t> triangleWedges;
+
+    size_t occurence;
+    std::geometric_distribution<size_t> edgeStubDistribution(edgeProbability);
+    std::geometric_distribution<size_t> triangleWedgesDistribution(triangleProbability);
+
+
+    for (size_t i=0; i<n; i++){
+        occurence = edgeStubDistribution(generator);
+        if (occurence > 0)
+            edgeStubs.insert(edgeStubs.end(), occurence, i);
+
+        occurence = triangleWedgesDistribution(generator);
+        if (occurence > 0)
+            triangleWedges.insert(triangleWedges.end(), occurence, i);
+    }
+
+    // Mersenne twister does not seem compatible with this function so the rng is not specified
+    std::shuffle(std::begin(edgeStubs), std::end(edgeStubs), generator);
+    std::shuffle(std::begin(triangleWedges), std::end(triangleWedges), generator);
+
+
+    size_t stub1;
+    auto stubIterator = edgeStubs.begin();
+    while (stubIterator != edgeStubs.end()) {
+
+        stub1 = *stubIterator;
+        stubIterator++;
+        if (stubIterator == edgeStubs.end()) break;
+
+        if (stub1 != *stubIterator && hypergraph.getEdgeMultiplicity(stub1, *stubIterator) == 0)  // no loops and multiedges
+            hypergraph.addEdge(stub1, *stubIterator);
+        stubIterator++;
+    }
+
+
+    size_t wedge1, wedge2;
+    auto wedgeIterator = triangleWedges.begin();
+    while (wedgeIterator != triangleWedges.end()) {
+
+        wedge1 = *wedgeIterator;
+        wedgeIterator++;
+        if (wedgeIterator == triangleWedges.end()) break;
+
+        wedge2 = *wedgeIterator;
+        wedgeIterator++;
+        if (wedgeIterator == triangleWedges.end()) break;
+
+        // Triangles are stored in sets so duplicates are not added
+        if (areAllDifferent<size_t>({wedge1, wedge2, *wedgeIterator}))  // no hyperedge self-loop
+            hypergraph.addTriangle({wedge1, wedge2, *wedgeIterator});
+        wedgeIterator++;
+    }
+    return hypergraph;
+}
+
+static size_t nchoosek(size_t n, size_t k) {
+    if (k > n) return 0;
+    if (k == 1) return n;
+    if (k == 2) return choose2(n);
+    return n*(n-1)*(n-2)/6;
+}
+
+// Writes the k-combination {x_1<...<x_k} of rank C(x_1, 1)+...+C(x_k, k) (colexicographic order)
+// in ascending order, offset by "first"
+static void decodeCombination(size_t rank, size_t k, size_t first, size_t* vertices) {
+    for (; k>0; k--) {
+        // Largest x such that C(x, k) <= rank, starting from a floating point estimate
+        size_t x = k-1 + (size_t) pow(rank*(k == 3 ? 6. : k == 2 ? 2. : 1.), 1./k);
+        while (x > k-1 && nchoosek(x, k) > rank)
+            x--;
+        while (nchoosek(x+1, k) <= rank)
+            x++;
+        rank -= nchoosek(x, k);
+        vertices[k-1] = first+x;
+    }
+}
+
+// Pairs or triplets whose vertices are in the given communities. Hyperedges are drawn in the
+// index space of the block (product of the combinations within each community) by geometric skipping.
+struct SBMBlock {
+    std::vector<std::pair<size_t, size_t>> communityMultiplicities;
+    double probability;
+};
+
+static std::vector<std::array<size_t, 3>> drawSBMBlockHyperedges(const SBMBlock& block,
+        const std::vector<size_t>& communitySizes, const std::vector<size_t>& communityStarts, std::mt19937& blockGenerator) {
+    std::vector<std::array<size_t, 3>> hyperedges;
+    if (block.probability <= 0)
+        return hyperedges;
+
+    std::array<size_t, 3> combinationNumbers;
+    size_t groupNumber = block.communityMultiplicities.size();
+    size_t indexSpaceSize = 1;
+    for (size_t group=0; group<groupNumber; group++) {
+        auto& community_multiplicity = block.communityMultiplicities[group];
+        combinationNumbers[group] = nchoosek(communitySizes[community_multiplicity.first], community_multiplicity.second);
+        indexSpaceSize *= combinationNumbers[group];
+    }
+
+    std::uniform_real_distribution<double> distribution(0, 1);
+    const double logComplement = log1p(-block.probability);
+    std::array<size_t, 3> ranks;
+    size_t index = 0;
+    while (index < indexSpaceSize) {
+        double skip = block.probability >= 1 ? 0 : floor(log(1-distribution(blockGenerator))/logComplement);
+        if (skip >= indexSpaceSize-index)
+            break;
+        index += skip;
+
+        size_t remainingIndex = index;
+        for (size_t group=groupNumber; group>0; group--) {
+            ranks[group-1] = remainingIndex % combinationNumbers[group-1];
+            remainingIndex /= combinationNumbers[group-1];
+        }
+        std::array<size_t, 3> hyperedge {0, 0, 1};  // Edges are completed with their multiplicity
+        size_t position = 0;
+        for (size_t group=0; group<groupNumber; group++) {
+            auto& community_multiplicity = block.communityMultiplicities[group];
+            decodeCombination(ranks[group], community_multiplicity.second, communityStarts[community_multiplicity.first], &hyperedge[position]);
+            position += community_multiplicity.second;
+        }
+        hyperedges.push_back(hyperedge);
+        index++;
+    }
+    return hyperedges;
+}
+
+static std::vector<SBMBlock> getSBMBlocks(size_t communityNumber, size_t order, const std::vector<double>& intraCommunityProbabilities, double interCommunityProbability) {
+    std::vector<SBMBlock> blocks;
+    std::vector<size_t> communities(order, 0);
+
+    // Every non decreasing sequence of "order" communities
+    while (true) {
+        SBMBlock block;
+        for (auto community: communities)
+            if (!block.communityMultiplicities.empty() && block.communityMultiplicities.back().first == community)
+                block.communityMultiplicities.back().second++;
+            else
+                block.communityMultiplicities.push_back({community, 1});
+        block.probability = block.communityMultiplicities.size() == 1 ? intraCommunityProbabilities[communities[0]] : interCommunityProbability;
+        blocks.push_back(block);
+
+        size_t position = order;
+        while (position > 0 && communities[position-1] == communityNumber-1)
+            position--;
+        if (position == 0)
+            break;
+        communities[position-1]++;
+        std::fill(communities.begin()+position, communities.end(), communities[position-1]);
+    }
+    return blocks;
+}
+
+static std::vector<size_t> getSortedHyperedges(std::vector<std::vector<std::array<size_t, 3>>>& blockHyperedges) {
+    std::vector<std::array<size_t, 3>> hyperedges;
+    for (auto& block: blockHyperedges) {
+        hyperedges.insert(hyperedges.end(), block.begin(), block.end());
+        block.clear();
+    }
+    std::sort(hyperedges.begin(), hyperedges.end());
+
+    std::vector<size_t> flatHyperedges;
+    flatHyperedges.reserve(3*hyperedges.size());
+    for (auto& hyperedge: hyperedges)
+        flatHyperedges.insert(flatHyperedges.end(), hyperedge.begin(), hyperedge.end());
+    return flatHyperedges;
+}
+
+// Blocks are drawn in parallel, each with its own random stream so that the hypergraph
+// only depends on the state of generator.
+Hypergraph generateSBMHypergraph(const std::vector<double>& communitySizes,
+        const std::vector<double>& intraCommunityEdgeProbabilities, double interCommunityEdgeProbability,
+        const std::vector<double>& intraCommunityTriangleProbabilities, double interCommunityTriangleProbability,
+        size_t threadNumber) {
+    size_t n = 0;
+    std::vector<size_t> sizes, communityStarts;
+    for (auto size: communitySizes) {
+        if (size < 1) throw std::logic_error("The size of the communities for the SBM must be at least 1");
+        if ((long int) size - size != 0) throw std::logic_error("The community sizes must be integers");
+        communityStarts.push_back(n);
+        sizes.push_back(size);
+        n += size;
+    }
+    if (intraCommunityEdgeProbabilities.size() != sizes.size() || intraCommunityTriangleProbabilities.size() != sizes.size())
+        throw std::logic_error("There must be an intra community probability for each community of the SBM");
+
+    auto edgeBlocks = getSBMBlocks(sizes.size(), 2, intraCommunityEdgeProbabilities, interCommunityEdgeProbability);
+    auto triangleBlocks = getSBMBlocks(sizes.size(), 3, intraCommunityTriangleProbabilities, interCommunityTriangleProbability);
+    std::vector<std::vector<std::array<size_t, 3>>> edges(edgeBlocks.size()), triangles(triangleBlocks.size());
+
+    TaskGenerators blockGenerators;
+    runInParallel(edgeBlocks.size()+triangleBlocks.size(), [&](size_t task) {
+        auto blockGenerator = blockGenerators.get(task);
+        if (task < edgeBlocks.size())
+            edges[task] = drawSBMBlockHyperedges(edgeBlocks[task], sizes, communityStarts, blockGenerator);
+        else {
+            size_t block = task-edgeBlocks.size();
+            triangles[block] = drawSBMBlockHyperedges(triangleBlocks[block], sizes, communityStarts, blockGenerator);
+        }
+    }, threadNumber);
+
+    Hypergraph hypergraph(n);
+    auto sortedEdges = getSortedHyperedges(edges);
+    hypergraph.addSortedEdges(sortedEdges.data(), sortedEdges.size()/3);
+    auto sortedTriangles = getSortedHyperedges(triangles);
+    hypergraph.addSortedTriangles(sortedTriangles.data(), sortedTriangles.size()/3);
+    return hypergraph;
+}
+
+template<typename T>
+static bool areAllDifferent(const std::vector<T>& elements) {
+    bool areAllDifferent = true;
+    if (elements.size() < 2) throw std::logic_error("areAllDifferent function requires at least 2 arguments");
+
+    for (size_t i=0; i<elements.size()-1 && areAllDifferent; i++)
+        for (size_t j=i+1; j<elements.size() && areAllDifferent; j++)
+            areAllDifferent = elements[i] != elements[j];
+
+    return areAllDifferent;
+}
+
+static inline size_t choose2(size_t n){
+    return n*(n-1)/2;
+}
+
+static void addEdgesWithProbability(Hypergraph& hypergraph, double p) {
+    size_t n = hypergraph.getSize();
+
+    size_t i=0;
+    size_t j=0;
+
+
+    std::uniform_real_distribution<double> distribution(0, 1);
+    double r;
+
+    while (i<n) {
+        r = distribution(generator);
+        j += 1+floor(log(1-r)/log(1-p));
+        while (j >= i && i < n) {
+            j -= i;
+            i++;
+        }
+        if (i<n)
+            hypergraph.addEdge(i, j);
+    }
+}
+
+} //namespace GRIT
@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "GRIT/hypergraph_transformations.h"
+
+
+namespace GRIT {
+
+Hypergraph removeDisconnectedVertices(const Hypergraph& hypergraph) {
+    const size_t n = hypergraph.getSize();
+    std::vector<Index> newIndices(n, n);
+
+    size_t newSize = 0;
+    for (Index i=0; i<n; i++)
+        if (!hypergraph.getEdgesFrom(i).empty() || !hypergraph.getTrianglesFrom(i).empty())
+            newIndices[i] = newSize++;
+
+    // The remapping preserves the order, so the rows only need their neighbours sorted
+    std::vector<Index> edges;
+    edges.reserve(3*hypergraph.getEdgeNumber());
+    std::vector<std::array<Index, 3>> triangles;
+    triangles.reserve(hypergraph.getTriangleNumber());
+    std::vector<std::pair<Index, size_t>> rowEdges;
+
+    for (Index i=0; i<n; i++) {
+        rowEdges.clear();
+        for (auto& neighbour: hypergraph.getEdgesFrom(i))
+            if (i < neighbour.first)
+                rowEdges.push_back(neighbour);
+        std::sort(rowEdges.begin(), rowEdges.end());
+        for (auto& neighbour: rowEdges)
+            edges.insert(edges.end(), {newIndices[i], newIndices[neighbour.first], neighbour.second});
+
+        for (auto& triangleNeighbours: hypergraph.getTrianglesFrom(i))
+            if (i < triangleNeighbours.first)
+                for (auto k: triangleNeighbours.second)
+                    if (triangleNeighbours.first < k)
+                        triangles.push_back({newIndices[i], newIndices[triangleNeighbours.first], newIndices[k]});
+    }
+    std::sort(triangles.begin(), triangles.end());
+
+    std::vector<Index> flatTriangles;
+    flatTriangles.reserve(3*triangles.size());
+    for (auto& triangle: triangles)
+        flatTriangles.insert(flatTriangles.end(), triangle.begin(), triangle.end());
+
+    Hypergraph filteredHypergraph(newSize);
+    filteredHypergraph.addSortedEdges(edges.data(), edges.size()/3);
+    filteredHypergraph.addSortedTriangles(flatTriangles.data(), flatTriangles.size()/3);
+    return filteredHypergraph;
+}
+
+static Hypergraph projectHypergraph(const Hypergraph& hypergraph, bool keepHighestOrder) {
+    std::vector<Index> edges;
+    for (Index i=0; i<hypergraph.getSize(); i++)
+        for (auto& neighbourType: hypergraph.getHigherNeighbourTypes(i, true))
+            edges.insert(edges.end(), {i, neighbourType.first, keepHighestOrder ? neighbourType.second : 1});
+
+    Hypergraph graph(hypergraph.getSize());
+    graph.addSortedEdges(edges.data(), edges.size()/3);
+    return graph;
+}
+
+Hypergraph projectHypergraphOnGraph(const Hypergraph& hypergraph) {
+    return projectHypergraph(hypergraph, false);
+}
+
+Hypergraph projectHypergraphOnMultigraph(const Hypergraph& hypergraph) {
+    return projectHypergraph(hypergraph, true);
+}
+
+} //namespace GRIT
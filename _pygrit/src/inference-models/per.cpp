@@ -1,5 +1,6 @@
 #include "GRIT/inference-models/per.h"
 #include "GRIT/utility.h"
+#include "GRIT/observations_generation.h"
 
 
 double PER::execute(const std::string& what, size_t sampleSize, size_t burnin, size_t chain, size_t points, const std::list<size_t>& iterations,
@@ -22,44 +23,48 @@ double PER::execute(const std::string& what, size_t sampleSize, size_t burnin, s
             modelHyperparameters);
 
 
+    GRIT::OccupancyAccumulator occupancyAccumulator(hypergraph, false);
+    if (accumulateOccupancy)
+        hypergraphSampler.setOccupancyAccumulator(&occupancyAccumulator);
+
     ModelSampler sampler(hypergraph, parameters, parameterSampler, hypergraphSampler);
     sampler.hypergraphSampleDirectory = outputDirectory;
     sampler.parameterSampleDirectory  = outputDirectory;
     sampler.chainID = chain;
+    sampler.sampleFormat = sampleFormat;
+    sampler.sampleSink = sampleSink;
+    sampler.checkpointInterval = checkpointInterval;
+    sampler.canonicalizationInterval = canonicalizationInterval;
+    sampler.adaptiveMoves = adaptiveMoves;
+    sampler.convergenceMonitor = convergenceMonitor;
+    if (accumulateOccupancy)
+        sampler.occupancyAccumulator = &occupancyAccumulator;
+    sampler.checkpointFileName = getCheckpointFileName(outputDirectory, chain);
     parameters[1] = 0.;  // This parameter should always be 0 because it isn't considered in the model.
 
-    if (what == "sample") {
-        auto edgeTypeOccurences = sampler.sampleAndGetOccurences(sampleSize, burnin, false, true);
-        GRIT::writeSparseMatrixToBinary<size_t>(edgeTypeOccurences.first,  outputDirectory+"occurences"+std::to_string(chain)+"_edgetype1.bin");
-        GRIT::writeSparseMatrixToBinary<size_t>(edgeTypeOccurences.second, outputDirectory+"occurences"+std::to_string(chain)+"_edgetype2.bin");
+    if (what == "sample" || what == "resume") {
+        auto edgeTypeOccurences = what == "sample" ?
+            sampler.sampleAndGetOccurences(sampleSize, burnin, false, writeSamples) :
+            sampler.resumeAndGetOccurences(sampleSize, burnin, false, writeSamples);
+        if (writeSamples) {
+            GRIT::writeChainOccurences(edgeTypeOccurences.first, edgeTypeOccurences.second, sampler.getOccurencesSampleNumber(), outputDirectory, chain);
+            if (accumulateOccupancy)
+                writeOccupancyFractions(occupancyAccumulator, outputDirectory, chain);
+            if (isCollectingMoveStatistics())
+                GRIT::writeMoveStatisticsToJson(hypergraphSampler.getMoveStatistics(), getMoveStatisticsFileName(outputDirectory, chain));
+        }
     }
     else if (what == "sample_hypergraphs")
         sampler.sampleHypergraphChain(sampleSize, points, iterations);
 
+    samplingStatistics = sampler.getSamplingStatistics();
+    moveStatistics = hypergraphSampler.getMoveStatistics();
+    moveParameters = sampler.getMoveParameters();
     return sampler.getAverageLogLikelihood();
 }
 
 GRIT::Observations PER::generateObservations(const GRIT::Hypergraph& hypergraph, const GRIT::Parameters& parameters) const {
-    size_t size = hypergraph.getSize();
-    GRIT::Observations observations(size, std::vector<size_t>(size, 0));
-
-    std::poisson_distribution<size_t> distribution[2] = {
-                            std::poisson_distribution<size_t>(parameters[2]),
-                            std::poisson_distribution<size_t>(parameters[3])};
-
-
-    size_t observationsElement;
-    bool isEdge;
-    for (size_t i=0; i<size; i++){
-        for (size_t j=i+1; j<size; j++){
-            isEdge = hypergraph.getEdgeMultiplicity(i, j) > 0;
-
-            observationsElement = distribution[isEdge](GRIT::generator);
-            observations[i][j] = observationsElement;
-            observations[j][i] = observationsElement;
-        }
-    }
-    return observations;
+    return GRIT::PoissonObservationsGenerator(hypergraph, {parameters[2], parameters[3]}, false).generate();
 }
 
 std::list<double> PER::getPairwiseObservationsProbabilities(const GRIT::Hypergraph &hypergraph, const GRIT::Parameters &parameters, const GRIT::Observations &observations) const {
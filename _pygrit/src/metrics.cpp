@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "GRIT/metrics.h"
+#include "GRIT/parallel.h"
+
+
+namespace GRIT {
+
+size_t countEdgesInTriangles(const size_t* edgeTypes, size_t n, size_t threadNumber) {
+    // Neighbours j>i of the upper triangle
+    std::vector<std::vector<size_t>> upperNeighbours(n);
+    runInParallel(n, [&](size_t i) {
+        for (size_t j=i+1; j<n; j++)
+            if (edgeTypes[i*n+j] > 0)
+                upperNeighbours[i].push_back(j);
+    }, threadNumber);
+
+    std::vector<size_t> degrees(n, 0);
+    for (size_t i=0; i<n; i++) {
+        degrees[i] += upperNeighbours[i].size();
+        for (auto j: upperNeighbours[i])
+            degrees[j]++;
+    }
+
+    // Each pair is oriented towards the vertex of higher (degree, index) rank, which bounds the
+    // length of the lists that are intersected
+    std::vector<size_t> vertices(n), ranks(n);
+    std::iota(vertices.begin(), vertices.end(), 0);
+    std::sort(vertices.begin(), vertices.end(), [&](size_t i, size_t j) {
+            return degrees[i] < degrees[j] || (degrees[i] == degrees[j] && i < j); });
+    for (size_t rank=0; rank<n; rank++)
+        ranks[vertices[rank]] = rank;
+
+    // Ranks of the out-neighbours sorted, and whether the pair is of type 1
+    std::vector<std::vector<std::pair<size_t, bool>>> outNeighbours(n);
+    for (size_t i=0; i<n; i++)
+        for (auto j: upperNeighbours[i]) {
+            bool isEdge = edgeTypes[i*n+j] == 1;
+            if (ranks[i] < ranks[j])
+                outNeighbours[ranks[i]].push_back({ranks[j], isEdge});
+            else
+                outNeighbours[ranks[j]].push_back({ranks[i], isEdge});
+        }
+    upperNeighbours.clear();
+
+    // Pair p of the out-neighbours of r has the identifier firstPairs[r]+p
+    std::vector<size_t> firstPairs(n+1, 0);
+    for (size_t rank=0; rank<n; rank++)
+        firstPairs[rank+1] = firstPairs[rank] + outNeighbours[rank].size();
+    runInParallel(n, [&](size_t rank) { std::sort(outNeighbours[rank].begin(), outNeighbours[rank].end()); }, threadNumber);
+
+    std::vector<std::atomic<uint64_t>> inTriangle((firstPairs[n]+63)/64);
+    for (auto& word: inTriangle)
+        word = 0;
+    auto mark = [&](size_t pair) { inTriangle[pair/64].fetch_or(uint64_t(1) << (pair%64), std::memory_order_relaxed); };
+
+    runInParallel(n, [&](size_t u) {
+        auto& uNeighbours = outNeighbours[u];
+        for (size_t uv=0; uv<uNeighbours.size(); uv++) {
+            auto& vNeighbours = outNeighbours[uNeighbours[uv].first];
+            size_t uw = uv+1, vw = 0;
+            while (uw < uNeighbours.size() && vw < vNeighbours.size()) {
+                if (uNeighbours[uw].first < vNeighbours[vw].first)
+                    uw++;
+                else if (vNeighbours[vw].first < uNeighbours[uw].first)
+                    vw++;
+                else {
+                    if (uNeighbours[uv].second)
+                        mark(firstPairs[u]+uv);
+                    if (uNeighbours[uw].second)
+                        mark(firstPairs[u]+uw);
+                    if (vNeighbours[vw].second)
+                        mark(firstPairs[uNeighbours[uv].first]+vw);
+                    uw++;
+                    vw++;
+                }
+            }
+        }
+    }, threadNumber);
+
+    size_t count = 0;
+    for (auto& word: inTriangle)
+        count += std::bitset<64>(word.load()).count();
+    return count;
+}
+
+static const size_t RESIDUALS_CHUNK_SIZE = 1<<16;
+
+// Branchless so that the loop vectorizes. Integer sums are exact for any order of reduction.
+static void addResidualsOfChunk(const int8_t* edgeTypes, const uint32_t* observations, const uint32_t* replicate,
+        size_t pairNumber, int64_t sums[3], int64_t absoluteSums[3]) {
+    for (size_t pair=0; pair<pairNumber; pair++) {
+        int64_t residual = (int64_t) observations[pair] - (int64_t) replicate[pair];
+        int64_t absoluteResidual = residual < 0 ? -residual : residual;
+        for (int8_t type=0; type<3; type++) {
+            int64_t isType = edgeTypes[pair] == type;
+            sums[type] += isType*residual;
+            absoluteSums[type] += isType*absoluteResidual;
+        }
+    }
+}
+
+std::vector<ResidualsOfTypes> getResidualsOfTypes(const int8_t* edgeTypes, const uint32_t* observations,
+        const uint32_t* replicates, size_t replicateNumber, size_t pairNumber, size_t threadNumber) {
+    for (size_t pair=0; pair<pairNumber; pair++)
+        if (edgeTypes[pair] < 0 || edgeTypes[pair] > 2)
+            throw std::logic_error("Residuals of types: Edge types must be 0, 1 or 2.");
+
+    const size_t chunkNumber = (pairNumber+RESIDUALS_CHUNK_SIZE-1)/RESIDUALS_CHUNK_SIZE;
+    std::vector<std::array<int64_t, 6>> chunkSums(replicateNumber*chunkNumber);
+
+    runInParallel(chunkSums.size(), [&](size_t task) {
+        const size_t replicate = task/chunkNumber;
+        const size_t firstPair = (task%chunkNumber)*RESIDUALS_CHUNK_SIZE;
+        const size_t chunkSize = std::min(RESIDUALS_CHUNK_SIZE, pairNumber-firstPair);
+
+        int64_t sums[3] = {0, 0, 0}, absoluteSums[3] = {0, 0, 0};
+        addResidualsOfChunk(edgeTypes+firstPair, observations+firstPair, replicates+replicate*pairNumber+firstPair,
+                chunkSize, sums, absoluteSums);
+        chunkSums[task] = {sums[0], sums[1], sums[2], absoluteSums[0], absoluteSums[1], absoluteSums[2]};
+    }, threadNumber);
+
+    std::vector<ResidualsOfTypes> residuals(replicateNumber);
+    for (size_t replicate=0; replicate<replicateNumber; replicate++) {
+        std::array<int64_t, 6> total = {0, 0, 0, 0, 0, 0};
+        for (size_t chunk=0; chunk<chunkNumber; chunk++)
+            for (size_t i=0; i<6; i++)
+                total[i] += chunkSums[replicate*chunkNumber+chunk][i];
+
+        for (size_t type=0; type<3; type++) {
+            residuals[replicate].sums[type] = total[type];
+            residuals[replicate].absoluteSums[type] = total[3+type];
+        }
+    }
+    return residuals;
+}
+
+
+typedef std::vector<std::pair<Index, size_t>> PairTypes;
+
+static size_t countDifferentTypes(const PairTypes& pairTypes1, const PairTypes& pairTypes2) {
+    size_t differences = 0;
+    auto it1 = pairTypes1.begin();
+    auto it2 = pairTypes2.begin();
+    while (it1 != pairTypes1.end() && it2 != pairTypes2.end()) {
+        if (it1->first < it2->first) {
+            differences++;
+            it1++;
+        }
+        else if (it2->first < it1->first) {
+            differences++;
+            it2++;
+        }
+        else {
+            if (it1->second != it2->second)
+                differences++;
+            it1++;
+            it2++;
+        }
+    }
+    return differences + (pairTypes1.end()-it1) + (pairTypes2.end()-it2);
+}
+
+static size_t getHammingDistance(const Hypergraph& hypergraph1, const Hypergraph& hypergraph2, bool highestOrder) {
+    if (hypergraph1.getSize() != hypergraph2.getSize())
+        throw std::logic_error("Hamming distance: hypergraphs have different sizes");
+
+    size_t distance = 0;
+    for (Index i=0; i<hypergraph1.getSize(); i++)
+        distance += countDifferentTypes(hypergraph1.getHigherNeighbourTypes(i, highestOrder), hypergraph2.getHigherNeighbourTypes(i, highestOrder));
+    return distance;
+}
+
+size_t getEdgeHammingDistance(const Hypergraph& hypergraph1, const Hypergraph& hypergraph2) {
+    return getHammingDistance(hypergraph1, hypergraph2, false);
+}
+
+size_t getGlobalHammingDistance(const Hypergraph& hypergraph1, const Hypergraph& hypergraph2) {
+    return getHammingDistance(hypergraph1, hypergraph2, true);
+}
+
+std::vector<size_t> getHammingDistancesToFiles(const Hypergraph& reference, const std::vector<std::string>& fileNames,
+        bool global, size_t threadNumber) {
+    const size_t n = reference.getSize();
+    std::vector<PairTypes> referenceTypes(n);
+    for (Index i=0; i<n; i++)
+        referenceTypes[i] = reference.getHigherNeighbourTypes(i, global);
+
+    std::vector<size_t> distances(fileNames.size(), 0);
+    runInParallel(fileNames.size(), [&](size_t file) {
+        auto sample = Hypergraph::loadFromBinary(fileNames[file]);
+        if (sample.getSize() != n)
+            throw std::logic_error("Hamming distance: hypergraph \""+fileNames[file]+"\" has a different size than the reference");
+
+        for (Index i=0; i<n; i++)
+            distances[file] += countDifferentTypes(referenceTypes[i], sample.getHigherNeighbourTypes(i, global));
+    }, threadNumber);
+    return distances;
+}
+
+} //namespace GRIT
@@ -0,0 +1,52 @@
+#include <fstream>
+#include <stdexcept>
+
+#include "GRIT/move_statistics.h"
+
+
+namespace GRIT {
+using namespace std;
+
+
+const char* MoveStatistics::getMoveTypeName(size_t moveType) {
+    static const char* names[MOVE_TYPE_NUMBER] = {"none", "edge", "triangle", "hidden edges", "pair", "shift"};
+    return names[moveType];
+}
+
+const char* MoveStatistics::getPhaseName(size_t phase) {
+    static const char* names[PHASE_NUMBER] = {"proposal", "model deltas", "proposer ratio", "apply"};
+    return names[phase];
+}
+
+const char* MoveStatistics::getTimeUnit() {
+#if defined(__x86_64__) || defined(__i386__)
+    return "cycles";
+#else
+    return "ns";
+#endif
+}
+
+void writeMoveStatisticsToJson(const MoveStatistics& statistics, const string& fileName) {
+    ofstream file(fileName);
+    if (!file.is_open())
+        throw runtime_error("Could not open file \""+fileName+"\".");
+
+    file << "{\n    \"time unit\": \"" << MoveStatistics::getTimeUnit() << "\"";
+    for (size_t moveType=0; moveType<MoveStatistics::MOVE_TYPE_NUMBER; moveType++)
+        for (auto move: {ADD, REMOVE}) {
+            auto& counters = statistics.get(moveType, move);
+            if (counters.proposed == 0)
+                continue;
+
+            file << ",\n    \"" << MoveStatistics::getMoveTypeName(moveType) << (move == ADD ? " add" : " remove") << "\": {"
+                 << "\"proposed\": " << counters.proposed << ", "
+                 << "\"accepted\": " << counters.accepted << ", "
+                 << "\"unchanged\": " << counters.unchanged;
+            for (size_t phase=0; phase<MoveStatistics::PHASE_NUMBER; phase++)
+                file << ", \"" << MoveStatistics::getPhaseName(phase) << " time\": " << counters.time[phase];
+            file << "}";
+        }
+    file << "\n}\n";
+}
+
+} //namespace GRIT
@@ -0,0 +1,161 @@
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include "GRIT/npy.h"
+
+
+namespace GRIT {
+using namespace std;
+
+
+static const char NPY_MAGIC[6] = {'\x93', 'N', 'U', 'M', 'P', 'Y'};
+
+struct NpyHeader {
+    char byteOrder;
+    char kind;
+    size_t itemSize;
+    bool fortranOrder;
+    vector<size_t> shape;
+};
+
+
+static string getHeaderValue(const string& header, const string& key, const string& fileName) {
+    size_t keyPosition = header.find("'"+key+"'");
+    if (keyPosition == string::npos)
+        throw runtime_error("Numpy file \""+fileName+"\" has no \""+key+"\" field.");
+
+    size_t valueStart = header.find(':', keyPosition);
+    if (valueStart == string::npos)
+        throw runtime_error("Numpy file \""+fileName+"\" has an invalid header.");
+    valueStart = header.find_first_not_of(' ', valueStart+1);
+
+    size_t valueEnd;
+    if (header[valueStart] == '(')
+        valueEnd = header.find(')', valueStart)+1;
+    else if (header[valueStart] == '\'')
+        valueEnd = header.find('\'', valueStart+1)+1;
+    else
+        valueEnd = header.find_first_of(",}", valueStart);
+
+    if (valueEnd == string::npos || valueEnd == 0)
+        throw runtime_error("Numpy file \""+fileName+"\" has an invalid header.");
+    return header.substr(valueStart, valueEnd-valueStart);
+}
+
+static NpyHeader readHeader(ifstream& file, const string& fileName) {
+    char magic[6];
+    uint8_t majorVersion, minorVersion;
+    file.read(magic, 6);
+    readBinaryValue(file, majorVersion);
+    readBinaryValue(file, minorVersion);
+    if (!file || memcmp(magic, NPY_MAGIC, 6) != 0)
+        throw runtime_error("File \""+fileName+"\" is not a numpy file.");
+
+    uint32_t headerLength;
+    if (majorVersion == 1) {
+        uint16_t shortHeaderLength;
+        readBinaryValue(file, shortHeaderLength);
+        headerLength = shortHeaderLength;
+    }
+    else if (majorVersion == 2 || majorVersion == 3)
+        readBinaryValue(file, headerLength);
+    else
+        throw runtime_error("Numpy file \""+fileName+"\" has unsupported version "+to_string(majorVersion)+".");
+
+    string header(headerLength, '\0');
+    file.read(&header[0], headerLength);
+    if (!file)
+        throw runtime_error("Numpy file \""+fileName+"\" is truncated.");
+
+    NpyHeader npyHeader;
+    string descr = getHeaderValue(header, "descr", fileName);
+    if (descr.size() < 4)
+        throw runtime_error("Numpy file \""+fileName+"\" has unsupported type "+descr+".");
+    npyHeader.byteOrder = descr[1];
+    npyHeader.kind = descr[2];
+    npyHeader.itemSize = stoul(descr.substr(3, descr.size()-4));
+
+    npyHeader.fortranOrder = getHeaderValue(header, "fortran_order", fileName) == "True";
+
+    string shape = getHeaderValue(header, "shape", fileName);
+    for (size_t position=1; position<shape.size(); ) {
+        size_t next = shape.find_first_of(",)", position);
+        string dimension = shape.substr(position, next-position);
+        if (dimension.find_first_not_of(' ') != string::npos)
+            npyHeader.shape.push_back(stoul(dimension));
+        position = next+1;
+    }
+    return npyHeader;
+}
+
+template<typename T>
+static size_t convertElement(const char* data) {
+    T value;
+    memcpy(&value, data, sizeof(T));
+    if (value < 0 || value != std::floor(value))
+        throw runtime_error("Observations must be non-negative integers.");
+    return (size_t) value;
+}
+
+typedef size_t (*ElementConverter)(const char*);
+
+static ElementConverter getConverter(const NpyHeader& header, const string& fileName) {
+    if (header.byteOrder == '>' && header.itemSize > 1)
+        throw runtime_error("Numpy file \""+fileName+"\" is big-endian, which isn't supported.");
+
+    switch (header.kind) {
+        case 'b':
+        case 'u':
+            if (header.itemSize == 1) return &convertElement<uint8_t>;
+            if (header.itemSize == 2) return &convertElement<uint16_t>;
+            if (header.itemSize == 4) return &convertElement<uint32_t>;
+            if (header.itemSize == 8) return &convertElement<uint64_t>;
+            break;
+        case 'i':
+            if (header.itemSize == 1) return &convertElement<int8_t>;
+            if (header.itemSize == 2) return &convertElement<int16_t>;
+            if (header.itemSize == 4) return &convertElement<int32_t>;
+            if (header.itemSize == 8) return &convertElement<int64_t>;
+            break;
+        case 'f':
+            if (header.itemSize == 4) return &convertElement<float>;
+            if (header.itemSize == 8) return &convertElement<double>;
+            break;
+    }
+    throw runtime_error("Numpy file \""+fileName+"\" has unsupported type "+header.kind+to_string(header.itemSize)+".");
+}
+
+Observations loadObservationsFromNpy(const string& fileName) {
+    ifstream file(fileName, ios::binary);
+    if (!file.is_open())
+        throw runtime_error("Could not open file \""+fileName+"\".");
+
+    NpyHeader header = readHeader(file, fileName);
+    if (header.shape.size() != 2 || header.shape[0] != header.shape[1])
+        throw runtime_error("Observations of \""+fileName+"\" aren't a square matrix.");
+    ElementConverter convert = getConverter(header, fileName);
+
+    size_t n = header.shape[0];
+    vector<char> data(n*n*header.itemSize);
+    file.read(data.data(), data.size());
+    if (!file)
+        throw runtime_error("Numpy file \""+fileName+"\" is truncated.");
+
+    Observations observations(n, vector<size_t>(n, 0));
+    for (size_t i=0; i<n; i++)
+        for (size_t j=0; j<n; j++) {
+            size_t position = header.fortranOrder ? j*n+i : i*n+j;
+            observations[i][j] = i == j ? 0 : convert(&data[position*header.itemSize]);
+        }
+
+    for (size_t i=0; i<n; i++)
+        for (size_t j=i+1; j<n; j++)
+            if (observations[i][j] != observations[j][i])
+                throw runtime_error("Observations of \""+fileName+"\" are not symmetric.");
+    return observations;
+}
+
+} //namespace GRIT
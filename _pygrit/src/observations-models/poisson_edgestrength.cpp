@@ -1,15 +1,22 @@
+#include <cmath>
 #include <stdexcept>
 #include "GRIT/observations-models/poisson_edgestrength.h"
 
 
 namespace GRIT {
 
+void PoissonEdgeStrengthObservationsModel::updateParameterCache() {
+    for (size_t i=0; i<3; i++) {
+        mu[i] = parameters[mu0Index+i];
+        logMu[i] = log(mu[i]);
+    }
+}
+
 double PoissonEdgeStrengthObservationsModel::operator()(const TwoStepsEdgeProposal& proposal) const{
     size_t i=proposal.chosenEdge.first;
     size_t j=proposal.chosenEdge.second;
 
     const size_t& m = hypergraph.getEdgeMultiplicity(i, j);
-    const double mu[3] = { parameters[mu0Index], parameters[mu0Index+1], parameters[mu0Index+2] };
 
 
     if (m == 0 && proposal.move == REMOVE)
@@ -20,9 +27,9 @@ double PoissonEdgeStrengthObservationsModel::operator()(const TwoStepsEdgePropos
 
     double logAcceptance;
     if (proposal.move == ADD)
-        logAcceptance = observations[i][j]*( log(mu[m+1]) - log(mu[m]) ) - (mu[m+1]-mu[m]);
+        logAcceptance = observations[i][j]*( logMu[m+1] - logMu[m] ) - (mu[m+1]-mu[m]);
     else
-        logAcceptance = observations[i][j]*( log(mu[m-1]) - log(mu[m]) ) - (mu[m-1]-mu[m]);
+        logAcceptance = observations[i][j]*( logMu[m-1] - logMu[m] ) - (mu[m-1]-mu[m]);
 
     return logAcceptance;
 }
@@ -30,34 +30,39 @@ double PoissonHypergraphObservationsModel::operator()(const SixStepsHypergraphPr
     if (proposal.moveType == SixStepsHypergraphProposal::TRIANGLE) {
         logAcceptance += getTriangleContribution( {i, j, k}, proposal.move );
     }
-    else if (proposal.moveType == SixStepsHypergraphProposal::EDGE)
+    else if (proposal.moveType == SixStepsHypergraphProposal::EDGE || proposal.moveType == SixStepsHypergraphProposal::PAIR)
        logAcceptance += getEdgeContribution(i, j, proposal.move );
+    else if (proposal.moveType == SixStepsHypergraphProposal::SHIFT)
+       logAcceptance += getTriangleShiftContribution(proposal.chosenTriplet, proposal.shiftedTriplet);
     // HIDDEN_EDGES move has not impact on the observations probability
 
     return logAcceptance;
 }
 
+void PoissonHypergraphObservationsModel::updateParameterCache() {
+    for (size_t i=0; i<3; i++) {
+        mu[i] = parameters[mu0Index+i];
+        logMu[i] = log(mu[i]);
+    }
+}
+
 double PoissonHypergraphObservationsModel::getTriangleContribution(const Triplet& triplet, const AddRemoveMove& move) const {
-    const double mu[3] = { parameters[mu0Index], parameters[mu0Index+1], parameters[mu0Index+2] };
+    const Triplet orderedTriplet = triplet.getOrdered();
+    const size_t& i = orderedTriplet.i;
+    const size_t& j = orderedTriplet.j;
+    const size_t& k = orderedTriplet.k;
 
-    size_t proposalEdgeType;
-    list<pair<size_t, size_t>> pairsInTriangle ({ {triplet.i, triplet.j}, {triplet.i, triplet.k}, {triplet.j, triplet.k} });
+    // For removals, the removed triplet is skipped
+    auto proposalEdgeTypes = hypergraph.getTripletPairsHighestOrder(orderedTriplet, move == REMOVE);
+    const size_t pairObservations[3] = { observations[i][j], observations[i][k], observations[j][k] };
 
     double logLikelihood = 0;
-
-
-    for (auto it=pairsInTriangle.begin(); it!=pairsInTriangle.end(); it++) {
-        if (move == REMOVE)  // skips the removed triplet
-            proposalEdgeType = hypergraph.getHighestOrderHyperedgeExcluding(it->first, it->second, triplet);
-        else
-            proposalEdgeType = hypergraph.getHighestOrderHyperedgeWith(it->first, it->second);
-
-
+    for (size_t pair=0; pair<3; pair++) {
+        const size_t& proposalEdgeType = proposalEdgeTypes[pair];
         if (proposalEdgeType != 2)
-            logLikelihood += observations[it->first][it->second]*( log(mu[proposalEdgeType]) - log(mu[2]) ) - (mu[proposalEdgeType]-mu[2]);
+            logLikelihood += pairObservations[pair]*( logMu[proposalEdgeType] - logMu[2] ) - (mu[proposalEdgeType]-mu[2]);
     }
 
-
     if (move == ADD)
         logLikelihood = -logLikelihood;
 
@@ -69,7 +74,6 @@ double PoissonHypergraphObservationsModel::getTriangleContribution(const Triplet
 }
 
 double PoissonHypergraphObservationsModel::getEdgeContribution(c_Index& i, c_Index &j, const AddRemoveMove& move) const {
-    const double mu[3] = { parameters[mu0Index], parameters[mu0Index+1], parameters[mu0Index+2] };
 
 
     size_t proposalEdgeType;
@@ -81,7 +85,7 @@ double PoissonHypergraphObservationsModel::getEdgeContribution(c_Index& i, c_Ind
     double logLikelihood = 0;
 
     if (proposalEdgeType == 0)
-        logLikelihood += observations[i][j]*( log(mu[0]) - log(mu[1]) ) - (mu[0] - mu[1]);
+        logLikelihood += observations[i][j]*( logMu[0] - logMu[1] ) - (mu[0] - mu[1]);
 
     if (move == ADD)
         logLikelihood = -logLikelihood;
@@ -93,17 +97,46 @@ double PoissonHypergraphObservationsModel::getEdgeContribution(c_Index& i, c_Ind
     return logLikelihood;
 }
 
+// The pair {i, j} stays covered by a triangle. Pairs {i, k} and {j, k} may lose their
+// triangle while pairs {i, l} and {j, l} gain one.
+double PoissonHypergraphObservationsModel::getTriangleShiftContribution(const Triplet& triplet, const Triplet& shiftedTriplet) const {
+    if (triplet == shiftedTriplet)
+        return 0;
+
+    const size_t& k = triplet.k;
+    const size_t& l = shiftedTriplet.k;
+
+    double logLikelihood = 0;
+    for (auto vertex: {triplet.i, triplet.j}) {
+        size_t removedEdgeType = hypergraph.getHighestOrderHyperedgeExcluding(vertex, k, triplet);
+        if (removedEdgeType != 2)
+            logLikelihood += observations[vertex][k]*( logMu[removedEdgeType] - logMu[2] ) - (mu[removedEdgeType]-mu[2]);
+
+        size_t addedEdgeType = hypergraph.getHighestOrderHyperedgeWith(vertex, l);
+        if (addedEdgeType != 2)
+            logLikelihood -= observations[vertex][l]*( logMu[addedEdgeType] - logMu[2] ) - (mu[addedEdgeType]-mu[2]);
+    }
+
+    if (std::isnan(logLikelihood))
+        throw runtime_error("ObservationModel: logLikelihood is NaN for triangle shift proposition. Means are "
+                +std::to_string(mu[0]) + ", " + std::to_string(mu[1]) + ", " + std::to_string(mu[2]) + ".");
+
+    return logLikelihood;
+}
+
 
 double PoissonHypergraphObservationsModel::getLoglikelihood() const{
     const size_t& n = hypergraph.getSize();
+    // Evaluated from the parameters since it is called right after they are sampled
     const double mu[3] = { parameters[mu0Index], parameters[mu0Index+1], parameters[mu0Index+2] };
+    const double logMu[3] = { log(mu[0]), log(mu[1]), log(mu[2]) };
 
     double logLikelihood = 0;
 
     for (size_t i=0; i<n; i++) {
         for (size_t j=i+1; j<n; j++) {
-            const double& mean = mu[hypergraph.getHighestOrderHyperedgeWith(i, j)];
-            logLikelihood += observations[i][j]*log(mean) - lgamma(observations[i][j]+1) - mean;
+            const size_t edgeType = hypergraph.getHighestOrderHyperedgeWith(i, j);
+            logLikelihood += observations[i][j]*logMu[edgeType] - lgamma(observations[i][j]+1) - mu[edgeType];
         }
     }
     return logLikelihood;
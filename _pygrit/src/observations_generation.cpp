@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include "GRIT/observations_generation.h"
+
+
+namespace GRIT {
+
+// Above this mean, most background counts are non-zero and zero-truncated counts are drawn by rejection
+static const double MAXIMUM_INVERSION_MEAN = 1;
+
+PoissonObservationsGenerator::PoissonObservationsGenerator(const Hypergraph& hypergraph, const std::vector<double>& means, bool withTriangles):
+        hypergraph(hypergraph), means(means), withTriangles(withTriangles)
+{
+    if (means.empty())
+        throw std::logic_error("PoissonObservationsGenerator: At least one mean is required.");
+    for (auto mean: means)
+        if (!(mean >= 0))
+            throw std::logic_error("PoissonObservationsGenerator: Means must be non-negative.");
+
+    backgroundProbability = -expm1(-means[0]);
+}
+
+// Pairs (i, j), j>i, of non-zero type sorted by j
+std::vector<std::pair<Index, size_t>> PoissonObservationsGenerator::getRowTypes(Index i) const {
+    const size_t maximumType = means.size()-1;
+    std::vector<std::pair<Index, size_t>> rowTypes;
+
+    for (auto& neighbour: hypergraph.getEdgesFrom(i))
+        if (neighbour.first > i && neighbour.second > 0)
+            rowTypes.push_back({neighbour.first, std::min(neighbour.second, maximumType)});
+
+    if (withTriangles && maximumType > 0) {
+        const size_t triangleType = std::min<size_t>(2, maximumType);
+        for (auto& triangleNeighbours: hypergraph.getTrianglesFrom(i)) {
+            if (triangleNeighbours.first > i)
+                rowTypes.push_back({triangleNeighbours.first, triangleType});
+            for (auto k: triangleNeighbours.second)
+                if (k > i)
+                    rowTypes.push_back({k, triangleType});
+        }
+        // An edge and a triangle on the same pair leave the triangle type first
+        std::sort(rowTypes.begin(), rowTypes.end(),
+                [](const std::pair<Index, size_t>& a, const std::pair<Index, size_t>& b) {
+                    return a.first < b.first || (a.first == b.first && a.second > b.second);
+                });
+        rowTypes.erase(std::unique(rowTypes.begin(), rowTypes.end(),
+                    [](const std::pair<Index, size_t>& a, const std::pair<Index, size_t>& b) { return a.first == b.first; }),
+                rowTypes.end());
+    }
+    else
+        std::sort(rowTypes.begin(), rowTypes.end());
+    return rowTypes;
+}
+
+size_t PoissonObservationsGenerator::drawNonZeroBackground(std::mt19937& rowGenerator) const {
+    const double mean = means[0];
+    if (mean > MAXIMUM_INVERSION_MEAN) {
+        std::poisson_distribution<size_t> distribution(mean);
+        size_t count;
+        do {
+            count = distribution(rowGenerator);
+        } while (count == 0);
+        return count;
+    }
+
+    // Inversion of the zero-truncated distribution
+    double u = std::uniform_real_distribution<double>(0, backgroundProbability)(rowGenerator);
+    double probability = exp(-mean)*mean;
+    size_t count = 1;
+    while (u > probability && probability > 0) {
+        u -= probability;
+        count++;
+        probability *= mean/count;
+    }
+    return count;
+}
+
+std::vector<std::pair<Index, size_t>> PoissonObservationsGenerator::drawRow(Index i, std::mt19937& rowGenerator) const {
+    const size_t n = hypergraph.getSize();
+    auto rowTypes = getRowTypes(i);
+    std::vector<std::pair<Index, size_t>> counts;
+
+    std::vector<std::poisson_distribution<size_t>> distributions;
+    for (auto mean: means)
+        distributions.emplace_back(mean);
+
+    auto rowType = rowTypes.begin();
+    auto drawTypedPairsBefore = [&](Index j) {
+        for (; rowType != rowTypes.end() && rowType->first < j; rowType++) {
+            size_t count = distributions[rowType->second](rowGenerator);
+            if (count > 0)
+                counts.push_back({rowType->first, count});
+        }
+    };
+
+    if (backgroundProbability > 0) {
+        std::uniform_real_distribution<double> uniform(0, 1);
+        const double logFailure = log1p(-backgroundProbability);
+
+        for (Index j=i+1; j<n; j++) {
+            if (backgroundProbability < 1) {
+                double skip = floor(log(1-uniform(rowGenerator))/logFailure);
+                if (skip >= n-j)
+                    break;
+                j += skip;
+            }
+            drawTypedPairsBefore(j);
+            if (rowType != rowTypes.end() && rowType->first == j)
+                continue;  // Drawn with its own mean when the row reaches the next candidate
+            counts.push_back({j, drawNonZeroBackground(rowGenerator)});
+        }
+    }
+    drawTypedPairsBefore(n);
+    return counts;
+}
+
+void PoissonObservationsGenerator::drawRowBlock(size_t block, std::mt19937& blockGenerator,
+        const std::function<void(Index, std::vector<std::pair<Index, size_t>>&&)>& storeRow) const {
+    const size_t n = hypergraph.getSize();
+    for (Index i=block*ROWS_PER_STREAM; i<std::min(n, (block+1)*ROWS_PER_STREAM); i++)
+        storeRow(i, drawRow(i, blockGenerator));
+}
+
+SparseMatrix<size_t> PoissonObservationsGenerator::generateSparse(size_t threadNumber) const {
+    SparseMatrix<size_t> observations(hypergraph.getSize());
+    TaskGenerators streams;
+
+    runInParallel(getStreamNumber(), [&](size_t stream) {
+        auto streamGenerator = streams.get(stream);
+        drawRowBlock(stream, streamGenerator, [&](Index i, std::vector<std::pair<Index, size_t>>&& counts) {
+            observations[i].insert(counts.begin(), counts.end());
+        });
+    }, threadNumber);
+    return observations;
+}
+
+Observations PoissonObservationsGenerator::generate(size_t threadNumber) const {
+    const size_t n = hypergraph.getSize();
+    Observations observations(n, std::vector<size_t>(n, 0));
+    TaskGenerators streams;
+
+    // The rows of a block only write their upper triangle and its transpose
+    runInParallel(getStreamNumber(), [&](size_t stream) {
+        auto streamGenerator = streams.get(stream);
+        drawRowBlock(stream, streamGenerator, [&](Index i, std::vector<std::pair<Index, size_t>>&& counts) {
+            for (auto& count: counts) {
+                observations[i][count.first] = count.second;
+                observations[count.first][i] = count.second;
+            }
+        });
+    }, threadNumber);
+    return observations;
+}
+
+void PoissonObservationsGenerator::generateBatch(size_t replicateNumber, uint32_t* counts, size_t threadNumber) const {
+    const size_t n = hypergraph.getSize();
+    const size_t pairNumber = getPairNumber();
+    const size_t streamNumber = getStreamNumber();
+    TaskGenerators streams;
+
+    // The pairs of a row block are contiguous and are cleared by the task that draws them
+    runInParallel(replicateNumber*streamNumber, [&](size_t task) {
+        const size_t replicate = task/streamNumber, block = task%streamNumber;
+        uint32_t* replicateCounts = counts + replicate*pairNumber;
+
+        const Index firstRow = block*ROWS_PER_STREAM, lastRow = std::min(n, (block+1)*ROWS_PER_STREAM);
+        const size_t firstPair = getPairIndex(n, firstRow, firstRow+1);
+        const size_t lastPair = lastRow < n ? getPairIndex(n, lastRow, lastRow+1) : pairNumber;
+        if (lastPair > firstPair)
+            memset(replicateCounts+firstPair, 0, (lastPair-firstPair)*sizeof(uint32_t));
+
+        auto streamGenerator = streams.get(task);
+        drawRowBlock(block, streamGenerator, [&](Index i, std::vector<std::pair<Index, size_t>>&& rowCounts) {
+            for (auto& count: rowCounts) {
+                if (count.second > std::numeric_limits<uint32_t>::max())
+                    throw std::overflow_error("PoissonObservationsGenerator: Count exceeds the range of 32-bit integers.");
+                replicateCounts[getPairIndex(n, i, count.first)] = count.second;
+            }
+        });
+    }, threadNumber);
+}
+
+} //namespace GRIT
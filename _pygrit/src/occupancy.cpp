@@ -0,0 +1,237 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "GRIT/occupancy.h"
+
+
+namespace GRIT {
+
+void OccupancyAccumulator::start() {
+    size_t n = hypergraph.getSize();
+    pairs.assign(n, {});
+    triangles.clear();
+    stepNumber = 0;
+    recording = true;
+
+    for (Index i=0; i<n; i++)
+        for (auto& neighbour: hypergraph.getEdgesFrom(i))
+            if (i < neighbour.first)
+                updatePair(i, neighbour.first);
+
+    for (auto& triplet: hypergraph.getFullTriangleList()) {
+        updateTriangle(triplet);
+        if (correlation) {
+            auto ordered = triplet.getOrdered();
+            updatePair(ordered.i, ordered.j);
+            updatePair(ordered.i, ordered.k);
+            updatePair(ordered.j, ordered.k);
+        }
+    }
+}
+
+void OccupancyAccumulator::recordStep(const SixStepsHypergraphProposal& proposal, bool hypergraphChanged) {
+    if (!recording)
+        return;
+
+    if (hypergraphChanged) {
+        for (auto& pair: proposal.changedPairs)
+            updatePair(pair.first, pair.second);
+
+        if (proposal.moveType == SixStepsHypergraphProposal::TRIANGLE)
+            updateTriangle(proposal.chosenTriplet);
+        else if (proposal.moveType == SixStepsHypergraphProposal::SHIFT) {
+            updateTriangle(proposal.chosenTriplet);
+            updateTriangle(proposal.shiftedTriplet);
+        }
+    }
+    stepNumber++;
+}
+
+void OccupancyAccumulator::recordStep(const TwoStepsEdgeProposal& proposal, bool hypergraphChanged) {
+    if (!recording)
+        return;
+
+    if (hypergraphChanged)
+        updatePair(proposal.chosenEdge.first, proposal.chosenEdge.second);
+    stepNumber++;
+}
+
+size_t OccupancyAccumulator::getPairType(Index i, Index j) const {
+    size_t type = correlation ? hypergraph.getHighestOrderHyperedgeWith(i, j) : hypergraph.getEdgeMultiplicity(i, j);
+    return std::min<size_t>(type, 2);
+}
+
+size_t OccupancyAccumulator::getTriangleKey(const Triplet& orderedTriplet) const {
+    size_t n = hypergraph.getSize();
+    return (orderedTriplet.i*n + orderedTriplet.j)*n + orderedTriplet.k;
+}
+
+// A state entered at step t and left at step t' lasted for the steps t, ..., t'-1
+void OccupancyAccumulator::updatePair(Index i, Index j) {
+    if (i > j)
+        std::swap(i, j);
+    size_t type = getPairType(i, j);
+
+    auto it = pairs[i].find(j);
+    if (it == pairs[i].end()) {
+        if (type != 0)
+            pairs[i][j] = {type, stepNumber, {0, 0}};
+        return;
+    }
+
+    auto& pair = it->second;
+    if (pair.type == type)
+        return;
+    if (pair.type != 0)
+        pair.steps[pair.type-1] += stepNumber-pair.lastChange;
+    pair.type = type;
+    pair.lastChange = stepNumber;
+}
+
+void OccupancyAccumulator::updateTriangle(const Triplet& triplet) {
+    auto ordered = triplet.getOrdered();
+    bool present = hypergraph.isTriangle(ordered);
+
+    auto it = triangles.find(getTriangleKey(ordered));
+    if (it == triangles.end()) {
+        if (present)
+            triangles[getTriangleKey(ordered)] = {true, stepNumber, 0};
+        return;
+    }
+
+    auto& triangle = it->second;
+    if (triangle.present == present)
+        return;
+    if (triangle.present)
+        triangle.steps += stepNumber-triangle.lastChange;
+    triangle.present = present;
+    triangle.lastChange = stepNumber;
+}
+
+std::pair<EdgeTypeFrequencies, EdgeTypeFrequencies> OccupancyAccumulator::getPairOccupancies() const {
+    EdgeTypeFrequencies edgetype1(pairs.size()), edgetype2(pairs.size());
+
+    for (Index i=0; i<pairs.size(); i++)
+        for (auto& j_pair: pairs[i]) {
+            auto& pair = j_pair.second;
+            size_t steps[2] = {pair.steps[0], pair.steps[1]};
+            if (pair.type != 0)
+                steps[pair.type-1] += stepNumber-pair.lastChange;
+
+            if (steps[0] > 0)
+                edgetype1[i][j_pair.first] = steps[0];
+            if (steps[1] > 0)
+                edgetype2[i][j_pair.first] = steps[1];
+        }
+    return {edgetype1, edgetype2};
+}
+
+std::vector<std::pair<Triplet, size_t>> OccupancyAccumulator::getTriangleOccupancies() const {
+    size_t n = hypergraph.getSize();
+    std::vector<std::pair<Triplet, size_t>> occupancies;
+    occupancies.reserve(triangles.size());
+
+    for (auto& key_triangle: triangles) {
+        auto& triangle = key_triangle.second;
+        size_t steps = triangle.steps + (triangle.present ? stepNumber-triangle.lastChange : 0);
+        if (steps == 0)
+            continue;
+
+        size_t key = key_triangle.first;
+        occupancies.push_back({{key/(n*n), (key/n)%n, key%n}, steps});
+    }
+    return occupancies;
+}
+
+std::pair<SparseMatrix<double>, SparseMatrix<double>> OccupancyAccumulator::getPairOccupancyFractions() const {
+    auto occupancies = getPairOccupancies();
+    SparseMatrix<double> fractions[2] = {SparseMatrix<double>(pairs.size()), SparseMatrix<double>(pairs.size())};
+    if (stepNumber == 0)
+        return {fractions[0], fractions[1]};
+
+    for (size_t type=0; type<2; type++) {
+        auto& steps = type == 0 ? occupancies.first : occupancies.second;
+        for (size_t i=0; i<steps.size(); i++)
+            for (auto& j_steps: steps[i])
+                fractions[type][i][j_steps.first] = (double) j_steps.second/stepNumber;
+    }
+    return {fractions[0], fractions[1]};
+}
+
+void OccupancyAccumulator::writeState(std::ostream& stream) const {
+    writeBinaryValue(stream, recording);
+    writeBinaryValue(stream, stepNumber);
+
+    size_t pairNumber = 0;
+    for (auto& row: pairs)
+        pairNumber += row.size();
+    writeBinaryValue(stream, pairNumber);
+    for (Index i=0; i<pairs.size(); i++)
+        for (auto& j_pair: pairs[i]) {
+            auto& pair = j_pair.second;
+            writeBinaryValue(stream, i);
+            writeBinaryValue(stream, j_pair.first);
+            writeBinaryValue(stream, pair.type);
+            writeBinaryValue(stream, pair.lastChange);
+            writeBinaryValue(stream, pair.steps[0]);
+            writeBinaryValue(stream, pair.steps[1]);
+        }
+
+    writeBinaryValue(stream, triangles.size());
+    for (auto& key_triangle: triangles) {
+        auto& triangle = key_triangle.second;
+        writeBinaryValue(stream, key_triangle.first);
+        writeBinaryValue(stream, triangle.present);
+        writeBinaryValue(stream, triangle.lastChange);
+        writeBinaryValue(stream, triangle.steps);
+    }
+}
+
+void OccupancyAccumulator::readState(std::istream& stream) {
+    size_t n = hypergraph.getSize();
+    bool restoredRecording = false;
+    size_t restoredStepNumber = 0, pairNumber = 0, triangleNumber = 0;
+    std::vector<std::unordered_map<Index, PairOccupancy>> restoredPairs(n);
+    std::unordered_map<size_t, TriangleOccupancy> restoredTriangles;
+
+    readBinaryValue(stream, restoredRecording);
+    readBinaryValue(stream, restoredStepNumber);
+    readBinaryValue(stream, pairNumber);
+    if (!stream || pairNumber > nchoose2(n))
+        throw std::runtime_error("OccupancyAccumulator: the state is truncated or corrupted.");
+    for (size_t m=0; m<pairNumber; m++) {
+        Index i, j;
+        PairOccupancy pair;
+        readBinaryValue(stream, i);
+        readBinaryValue(stream, j);
+        readBinaryValue(stream, pair.type);
+        readBinaryValue(stream, pair.lastChange);
+        readBinaryValue(stream, pair.steps[0]);
+        readBinaryValue(stream, pair.steps[1]);
+        if (!stream || i >= j || j >= n || pair.type > 2 || pair.lastChange > restoredStepNumber)
+            throw std::runtime_error("OccupancyAccumulator: the state is truncated or corrupted.");
+        restoredPairs[i][j] = pair;
+    }
+
+    readBinaryValue(stream, triangleNumber);
+    if (!stream || triangleNumber > nchoose3(n))
+        throw std::runtime_error("OccupancyAccumulator: the state is truncated or corrupted.");
+    for (size_t m=0; m<triangleNumber; m++) {
+        size_t key;
+        TriangleOccupancy triangle;
+        readBinaryValue(stream, key);
+        readBinaryValue(stream, triangle.present);
+        readBinaryValue(stream, triangle.lastChange);
+        readBinaryValue(stream, triangle.steps);
+        if (!stream || key >= n*n*n || triangle.lastChange > restoredStepNumber)
+            throw std::runtime_error("OccupancyAccumulator: the state is truncated or corrupted.");
+        restoredTriangles[key] = triangle;
+    }
+
+    recording = restoredRecording;
+    stepNumber = restoredStepNumber;
+    pairs = std::move(restoredPairs);
+    triangles = std::move(restoredTriangles);
+}
+
+} //namespace GRIT
@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "GRIT/utility.h"
+#include "GRIT/parallel.h"
+
+
+namespace GRIT {
+
+size_t getThreadNumber(size_t requestedThreads, size_t taskNumber) {
+    size_t threadNumber = requestedThreads;
+    if (threadNumber == 0)
+        threadNumber = std::max<size_t>(1, std::thread::hardware_concurrency());
+    return std::max<size_t>(1, std::min(threadNumber, taskNumber));
+}
+
+void runInParallel(size_t taskNumber, const std::function<void(size_t)>& task, size_t threadNumber) {
+    threadNumber = getThreadNumber(threadNumber, taskNumber);
+    if (threadNumber == 1) {
+        for (size_t i=0; i<taskNumber; i++)
+            task(i);
+        return;
+    }
+
+    std::atomic<size_t> nextTask(0);
+    std::exception_ptr taskError;
+    std::mutex errorMutex;
+
+    auto work = [&]() {
+        for (size_t i=nextTask++; i<taskNumber; i=nextTask++) {
+            try {
+                task(i);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!taskError)
+                    taskError = std::current_exception();
+                nextTask = taskNumber;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadNumber-1);
+    for (size_t i=1; i<threadNumber; i++)
+        threads.emplace_back(work);
+    work();
+    for (auto& thread: threads)
+        thread.join();
+
+    if (taskError)
+        std::rethrow_exception(taskError);
+}
+
+TaskGenerators::TaskGenerators() {
+    seed = std::uniform_int_distribution<uint64_t>()(generator);
+}
+
+std::mt19937 TaskGenerators::get(size_t task) const {
+    std::seed_seq sequence {(uint32_t) seed, (uint32_t) (seed>>32), (uint32_t) task, (uint32_t) ((uint64_t) task>>32)};
+    return std::mt19937(sequence);
+}
+
+} //namespace GRIT
@@ -0,0 +1,38 @@
+#include <stdexcept>
+
+#include "GRIT/proposers/edge-choosers/weighted_pair_chooser.h"
+
+
+namespace GRIT {
+
+ObservationsWeightedPairChooser::ObservationsWeightedPairChooser(const Observations& observations): observations(observations) {
+    size_t n = observations.size();
+    if (n < 2)
+        throw std::logic_error("ObservationsWeightedPairChooser: At least two vertices are required.");
+
+    std::vector<double> weights;
+    pairs.reserve(n*(n-1)/2);
+    weights.reserve(n*(n-1)/2);
+
+    for (size_t i=0; i<n; i++)
+        for (size_t j=i+1; j<n; j++) {
+            pairs.push_back({i, j});
+            weights.push_back(observations[i][j]+1);
+            totalWeight += observations[i][j]+1;
+        }
+    distribution = std::discrete_distribution<size_t>(weights.begin(), weights.end());
+}
+
+Edge ObservationsWeightedPairChooser::choose() {
+    return pairs[distribution(generator)];
+}
+
+double ObservationsWeightedPairChooser::getForwardProbability(const Edge& edge, const AddRemoveMove&) const {
+    return (observations[edge.first][edge.second]+1)/totalWeight;
+}
+
+double ObservationsWeightedPairChooser::getReverseProbability(const Edge& edge, const AddRemoveMove& move) const {
+    return getForwardProbability(edge, move);
+}
+
+} //namespace GRIT
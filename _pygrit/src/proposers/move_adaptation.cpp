@@ -0,0 +1,152 @@
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+#include "GRIT/utility.h"
+#include "GRIT/proposers/move_adaptation.h"
+
+
+namespace GRIT {
+
+MoveAdaptation::MoveAdaptation(const std::vector<double>& moveProbabilities, double eta):
+        initialMoveProbabilities(moveProbabilities), moveProbabilities(moveProbabilities),
+        squaredJumpSums(moveProbabilities.size(), 0), costSums(moveProbabilities.size(), 0),
+        eta(eta)
+{
+    double total = std::accumulate(moveProbabilities.begin(), moveProbabilities.end(), 0.);
+    if (total > 0)
+        for (auto& probability: initialMoveProbabilities)
+            probability /= total;
+    this->moveProbabilities = initialMoveProbabilities;
+}
+
+bool MoveAdaptation::recordStep(size_t moveType, AddRemoveMove move, double logAcceptanceWithoutEta, double squaredJump, double cost) {
+    auto& buffer = logRatios[move];
+    if (buffer.size() < RATIO_BUFFER_SIZE)
+        buffer.push_back(logAcceptanceWithoutEta);
+    else
+        buffer[ratioPositions[move]] = logAcceptanceWithoutEta;
+    ratioPositions[move] = (ratioPositions[move]+1) % RATIO_BUFFER_SIZE;
+
+    return recordStep(moveType, squaredJump, cost);
+}
+
+bool MoveAdaptation::recordStep(size_t moveType, double squaredJump, double cost) {
+    squaredJumpSums[moveType] += squaredJump;
+    costSums[moveType] += cost;
+
+    if (++stepsSinceUpdate < UPDATE_INTERVAL)
+        return false;
+
+    stepsSinceUpdate = 0;
+    updateMoveProbabilities();
+    updateEta();
+    return true;
+}
+
+void MoveAdaptation::updateMoveProbabilities() {
+    std::vector<double> jumpsPerCost(moveProbabilities.size(), 0);
+    double totalJumpsPerCost = 0;
+    for (size_t i=0; i<jumpsPerCost.size(); i++)
+        if (initialMoveProbabilities[i] > 0 && costSums[i] > 0) {
+            jumpsPerCost[i] = squaredJumpSums[i]/costSums[i];
+            totalJumpsPerCost += jumpsPerCost[i];
+        }
+    if (totalJumpsPerCost == 0)
+        return;
+
+    for (size_t i=0; i<jumpsPerCost.size(); i++)
+        moveProbabilities[i] = (1-INITIAL_PROBABILITIES_WEIGHT)*jumpsPerCost[i]/totalJumpsPerCost
+                                + INITIAL_PROBABILITIES_WEIGHT*initialMoveProbabilities[i];
+}
+
+static double getAverageAcceptance(const std::vector<double>& logRatios, double logEtaContribution) {
+    double total = 0;
+    for (auto logRatio: logRatios)
+        total += std::min(1., exp(logRatio+logEtaContribution));
+    return total/logRatios.size();
+}
+
+void MoveAdaptation::updateEta() {
+    if (logRatios[ADD].empty() || logRatios[REMOVE].empty())
+        return;
+
+    double bestAcceptance = -1;
+    for (double candidate=MINIMUM_ETA; candidate<=MAXIMUM_ETA+1e-9; candidate+=0.01) {
+        double logOdds = log(1-candidate) - log(candidate);
+        double acceptance = candidate*getAverageAcceptance(logRatios[ADD], logOdds)
+                            + (1-candidate)*getAverageAcceptance(logRatios[REMOVE], -logOdds);
+        if (acceptance > bestAcceptance) {
+            bestAcceptance = acceptance;
+            eta = candidate;
+        }
+    }
+}
+
+static void writeValues(std::ostream& stream, const std::vector<double>& values) {
+    writeBinaryValue(stream, values.size());
+    for (auto value: values)
+        writeBinaryValue(stream, value);
+}
+
+static void readValues(std::istream& stream, std::vector<double>& values, size_t maximumSize) {
+    size_t valueNumber = 0;
+    readBinaryValue(stream, valueNumber);
+    if (!stream || valueNumber > maximumSize)
+        throw std::runtime_error("MoveAdaptation: Invalid saved state.");
+    values.resize(valueNumber);
+    for (auto& value: values)
+        readBinaryValue(stream, value);
+}
+
+void MoveAdaptation::writeState(std::ostream& stream) const {
+    writeValues(stream, moveProbabilities);
+    writeValues(stream, squaredJumpSums);
+    writeValues(stream, costSums);
+    for (auto move: {REMOVE, ADD}) {
+        writeValues(stream, logRatios[move]);
+        writeBinaryValue(stream, ratioPositions[move]);
+    }
+    writeBinaryValue(stream, eta);
+    writeBinaryValue(stream, stepsSinceUpdate);
+}
+
+void MoveAdaptation::readState(std::istream& stream) {
+    const size_t moveTypeNumber = initialMoveProbabilities.size();
+    std::vector<double> restoredMoveProbabilities, restoredSquaredJumpSums, restoredCostSums;
+    std::array<std::vector<double>, 2> restoredLogRatios;
+    std::array<size_t, 2> restoredRatioPositions {0, 0};
+    double restoredEta = 0;
+    size_t restoredStepsSinceUpdate = 0;
+
+    readValues(stream, restoredMoveProbabilities, moveTypeNumber);
+    readValues(stream, restoredSquaredJumpSums, moveTypeNumber);
+    readValues(stream, restoredCostSums, moveTypeNumber);
+    if (restoredMoveProbabilities.size() != moveTypeNumber || restoredSquaredJumpSums.size() != moveTypeNumber || restoredCostSums.size() != moveTypeNumber)
+        throw std::runtime_error("MoveAdaptation: Saved state has an incorrect number of move types.");
+
+    for (auto move: {REMOVE, ADD}) {
+        readValues(stream, restoredLogRatios[move], RATIO_BUFFER_SIZE);
+        readBinaryValue(stream, restoredRatioPositions[move]);
+        // The next ratio is appended until the ring buffer is full
+        size_t ratioNumber = restoredLogRatios[move].size();
+        if (!stream || restoredRatioPositions[move] >= RATIO_BUFFER_SIZE
+                || (ratioNumber < RATIO_BUFFER_SIZE && restoredRatioPositions[move] != ratioNumber))
+            throw std::runtime_error("MoveAdaptation: Invalid saved state.");
+    }
+    readBinaryValue(stream, restoredEta);
+    readBinaryValue(stream, restoredStepsSinceUpdate);
+    if (!stream || restoredEta < 0 || restoredEta > 1 || restoredStepsSinceUpdate >= UPDATE_INTERVAL)
+        throw std::runtime_error("MoveAdaptation: Invalid saved state.");
+
+    moveProbabilities = restoredMoveProbabilities;
+    squaredJumpSums = restoredSquaredJumpSums;
+    costSums = restoredCostSums;
+    logRatios = restoredLogRatios;
+    ratioPositions = restoredRatioPositions;
+    eta = restoredEta;
+    stepsSinceUpdate = restoredStepsSinceUpdate;
+}
+
+} //namespace GRIT
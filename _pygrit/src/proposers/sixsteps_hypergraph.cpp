@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <numeric>
 #include "GRIT/proposers/sixsteps_hypergraph.h"
 
 
@@ -9,17 +10,24 @@ HypergraphSixStepsProposer::HypergraphSixStepsProposer(
                 TriangleChooserBase& triangleAdder, TriangleChooserBase& triangleRemover,
                 EdgeChooserBase& edgeAdder, EdgeChooserBase& edgeRemover,
                 const std::vector<double>& moveProbabilities, double eta, double chi_0, double chi_1):
-        hypergraph(hypergraph),
+        hypergraph(hypergraph), observations(observations),
         triangleAdder(triangleAdder), triangleRemover(triangleRemover),
         edgeAdder(edgeAdder), edgeRemover(edgeRemover),
-        eta(eta), chi_0(chi_0), chi_1(chi_1) {
+        eta(eta), chi_0(chi_0), chi_1(chi_1),
+        adaptation(moveProbabilities, eta) {
 
     addRemoveDistribution = std::bernoulli_distribution(eta);
 
-    if (moveProbabilities.size() != 3)
+    if (moveProbabilities.size() < 3 || moveProbabilities.size() > 5)
         throw std::logic_error("HypergraphSixStepsProposer: Incorrect number of move probabilities. There were " + std::to_string(moveProbabilities.size())
-                                + " given and 3 are required.");
+                                + " given and 3 to 5 are required.");
+    // The SHIFT acceptance ratio assumes that the choice of the triangle cancels out
+    if (moveProbabilities.size() == 5 && moveProbabilities[4] > 0 && !triangleRemover.isUniform())
+        throw std::logic_error("HypergraphSixStepsProposer: SHIFT moves require a uniform triangle remover.");
     moveTypeDistribution = std::discrete_distribution<int> {moveProbabilities.begin(), moveProbabilities.end()};
+
+    for (auto& row: observations)
+        observationsRowSums.push_back(std::accumulate(row.begin(), row.end(), (size_t) 0));
 }
 
 HypergraphSixStepsProposer::HypergraphSixStepsProposer(
@@ -27,21 +35,35 @@ HypergraphSixStepsProposer::HypergraphSixStepsProposer(
                 TriangleChooserBase& triangleAdder, TriangleChooserBase& triangleRemover,
                 EdgeChooserBase& edgeAdder, EdgeChooserBase& edgeRemover,
                 const std::vector<double>& moveProbabilities, double eta, double chi_0, double chi_1):
-        hypergraph(hypergraph),
+        hypergraph(hypergraph), observations(observations),
         triangleAdder(triangleAdder), triangleRemover(triangleRemover),
         edgeAdder(edgeAdder), edgeRemover(edgeRemover),
-        eta(eta), chi_0(chi_0), chi_1(chi_1)
+        eta(eta), chi_0(chi_0), chi_1(chi_1),
+        adaptation(moveProbabilities, eta)
 {
     addRemoveDistribution = std::bernoulli_distribution(eta);
 
-    if (moveProbabilities.size() != 3)
+    if (moveProbabilities.size() < 3 || moveProbabilities.size() > 5)
         throw std::logic_error("HypergraphSixStepsProposer: Incorrect number of move probabilities. There were " + std::to_string(moveProbabilities.size())
-                                + " given and 3 are required.");
+                                + " given and 3 to 5 are required.");
+    // The SHIFT acceptance ratio assumes that the choice of the triangle cancels out
+    if (moveProbabilities.size() == 5 && moveProbabilities[4] > 0 && !triangleRemover.isUniform())
+        throw std::logic_error("HypergraphSixStepsProposer: SHIFT moves require a uniform triangle remover.");
     moveTypeDistribution = std::discrete_distribution<int> {moveProbabilities.begin(), moveProbabilities.end()};
+
+    for (auto& row: observations)
+        observationsRowSums.push_back(std::accumulate(row.begin(), row.end(), (size_t) 0));
 }
 
 
 void HypergraphSixStepsProposer::generateProposal() {
+    drawProposal();
+
+    if (adapting)
+        etaLogContribution = getEtaLogContribution();
+}
+
+void HypergraphSixStepsProposer::drawProposal() {
     currentProposal.changedPairs.clear();
     currentProposal.unchangedPairsNumber = 0;
 
@@ -60,6 +82,14 @@ void HypergraphSixStepsProposer::generateProposal() {
         currentProposal.moveType = SixStepsHypergraphProposal::HIDDEN_EDGES;
         proposeHiddenEdges();
     }
+    else if (moveType == 3) {
+        currentProposal.moveType = SixStepsHypergraphProposal::PAIR;
+        proposePair();
+    }
+    else if (moveType == 4) {
+        currentProposal.moveType = SixStepsHypergraphProposal::SHIFT;
+        proposeTriangleShift();
+    }
     else
         throw std::logic_error("Move of type " + std::to_string(moveType) + " doesn't exist.");
 }
@@ -96,6 +126,93 @@ void HypergraphSixStepsProposer::proposeEdge() {
     currentProposal.changedPairs = { chosenEdge };
 }
 
+// Metropolised Gibbs update of the edge of a pair: the edge state is always flipped.
+// For a binary state, this is more efficient than drawing the state from its conditional.
+void HypergraphSixStepsProposer::proposePair() {
+    if (pairChooser == nullptr)
+        throw std::logic_error("HypergraphSixStepsProposer: PAIR moves require a pair chooser.");
+
+    Edge chosenPair = pairChooser->choose();
+    currentProposal.move = hypergraph.isEdge(chosenPair.first, chosenPair.second) ? REMOVE : ADD;
+    currentProposal.chosenTriplet.i = chosenPair.first;
+    currentProposal.chosenTriplet.j = chosenPair.second;
+    currentProposal.changedPairs = { chosenPair };
+}
+
+// Replaces the vertex k of a triangle {i, j, k} by a vertex l drawn with a weight of
+// observations[i][l]+observations[j][l]+1. The triangle remover is uniform (checked by the
+// constructors), so the choice of the triangle cancels out in the acceptance ratio.
+void HypergraphSixStepsProposer::proposeTriangleShift() {
+    currentProposal.move = ADD;
+
+    if (hypergraph.getTriangleNumber() == 0 || hypergraph.getSize() < 4) {
+        currentProposal.chosenTriplet = currentProposal.shiftedTriplet = {0, 0, 0};
+        return;
+    }
+
+    Triplet triangle = triangleRemover.choose().getOrdered();
+    size_t vertices[3] = {triangle.i, triangle.j, triangle.k};
+    size_t replacedIndex = std::uniform_int_distribution<size_t>(0, 2)(generator);
+    const size_t& i = vertices[(replacedIndex+1)%3];
+    const size_t& j = vertices[(replacedIndex+2)%3];
+    const size_t& k = vertices[replacedIndex];
+    currentProposal.chosenTriplet = {i, j, k};
+
+    size_t l = drawShiftedVertex();
+    currentProposal.shiftedTriplet = {i, j, l};
+    currentProposal.changedPairs = { {std::min(i, k), std::max(i, k)}, {std::min(j, k), std::max(j, k)},
+                                     {std::min(i, l), std::max(i, l)}, {std::min(j, l), std::max(j, l)} };
+}
+
+double HypergraphSixStepsProposer::getShiftWeight(size_t vertex) const {
+    const size_t& i = currentProposal.chosenTriplet.i;
+    const size_t& j = currentProposal.chosenTriplet.j;
+    return observations[i][vertex] + observations[j][vertex] + 1;
+}
+
+// Vertex l drawn with a probability proportional to its shift weight among the vertices other than i, j and k.
+// The cumulative weights are increasing with l, so l is found by bisection in O(log n).
+size_t HypergraphSixStepsProposer::drawShiftedVertex() {
+    if (observationsCumulativeRowSums.empty())
+        for (auto& row: observations) {
+            std::vector<size_t> cumulativeRow(row.size()+1, 0);
+            std::partial_sum(row.begin(), row.end(), cumulativeRow.begin()+1);
+            observationsCumulativeRowSums.push_back(std::move(cumulativeRow));
+        }
+
+    double draw = std::uniform_real_distribution<double>(0, getShiftTotalWeight()-getShiftWeight(currentProposal.chosenTriplet.k))(generator);
+
+    size_t lower = 0, upper = hypergraph.getSize()-1;
+    while (lower < upper) {
+        size_t middle = (lower+upper)/2;
+        if (getShiftWeightUpTo(middle) > draw)
+            upper = middle;
+        else
+            lower = middle+1;
+    }
+    return lower;
+}
+
+// Total weight of the vertices u<=vertex other than i, j and k
+double HypergraphSixStepsProposer::getShiftWeightUpTo(size_t vertex) const {
+    const size_t& i = currentProposal.chosenTriplet.i;
+    const size_t& j = currentProposal.chosenTriplet.j;
+    const size_t& k = currentProposal.chosenTriplet.k;
+    double weight = (double) observationsCumulativeRowSums[i][vertex+1] + observationsCumulativeRowSums[j][vertex+1] + vertex+1;
+    for (auto excludedVertex: {i, j, k})
+        if (excludedVertex <= vertex)
+            weight -= getShiftWeight(excludedVertex);
+    return weight;
+}
+
+// Total weight of the vertices other than i and j
+double HypergraphSixStepsProposer::getShiftTotalWeight() const {
+    const size_t& i = currentProposal.chosenTriplet.i;
+    const size_t& j = currentProposal.chosenTriplet.j;
+    return (double) observationsRowSums[i] + observationsRowSums[j] + hypergraph.getSize() - 2
+            - getShiftWeight(i) - getShiftWeight(j) + 2;
+}
+
 void HypergraphSixStepsProposer::proposeHiddenEdges() {
     std::set<Edge> unchangedPairs;
 
@@ -116,7 +233,7 @@ void HypergraphSixStepsProposer::proposeHiddenEdges() {
     pairsUnder3edgeNumber = unchangedPairs.size() + currentProposal.changedPairs.size();
 
     if (currentProposal.changedPairs.size() < 2)
-        generateProposal();
+        drawProposal();
 
     else {
         double chi = currentProposal.move == REMOVE ? chi_0: chi_1;
@@ -139,15 +256,37 @@ void HypergraphSixStepsProposer::updatePairHiddenEdgeMove(size_t i, size_t j, st
         unchangedPairs.insert({i, j});
 }
 
+double HypergraphSixStepsProposer::getEtaLogContribution() const {
+    const size_t& edgeNumber(hypergraph.getEdgeNumber()), triangleNumber(hypergraph.getTriangleNumber());
+    size_t maximumEdgeNumber(hypergraph.getMaximumEdgeNumber()), maximumTriangleNumber(hypergraph.getMaximumTriangleNumber());
+
+    if (currentProposal.moveType == SixStepsHypergraphProposal::HIDDEN_EDGES) {
+        int a = currentProposal.move == ADD;
+        return (2*a-1)*(log(1-eta)-log(eta));
+    }
+    if (currentProposal.moveType == SixStepsHypergraphProposal::PAIR || currentProposal.moveType == SixStepsHypergraphProposal::SHIFT)
+        return 0;
+
+    bool isEdge = currentProposal.moveType == SixStepsHypergraphProposal::EDGE;
+    const size_t& number = isEdge ? edgeNumber : triangleNumber;
+    const size_t& maximumNumber = isEdge ? maximumEdgeNumber : maximumTriangleNumber;
+
+    if (currentProposal.move == ADD) {
+        if (number == maximumNumber-1)
+            return -log(eta);
+        return log(1-eta) - log(eta);
+    }
+    if (number == 1)
+        return -log(1-eta);
+    return log(eta) - log(1-eta);
+}
+
 double HypergraphSixStepsProposer::getLogAcceptanceContribution() const {
     const size_t& i = currentProposal.chosenTriplet.i;
     const size_t& j = currentProposal.chosenTriplet.j;
     const size_t& k = currentProposal.chosenTriplet.k;
 
-    const size_t& edgeNumber(hypergraph.getEdgeNumber()), triangleNumber(hypergraph.getTriangleNumber());
-    size_t maximumEdgeNumber(hypergraph.getMaximumEdgeNumber()), maximumTriangleNumber(hypergraph.getMaximumTriangleNumber());
-
-    double logAcceptance = 0;
+    double logAcceptance = getEtaLogContribution();
 
 
     if (currentProposal.moveType == SixStepsHypergraphProposal::HIDDEN_EDGES) {
@@ -158,47 +297,41 @@ double HypergraphSixStepsProposer::getLogAcceptanceContribution() const {
         const auto& N_a = currentProposal.maximumChangedPairsNumber;
         const auto& N_not_a = pairsUnder3edgeNumber-N_a;
 
-        logAcceptance += (2*a-1)*(log(1-eta)-log(eta)) +
-            (m-2)*(log(1-chi_not_a) - log(1-chi_a))
+        logAcceptance += (m-2)*(log(1-chi_not_a) - log(1-chi_a))
             + log(chi_not_a) - log(chi_a) + log(1-pow(1-chi_a, N_a-1)) - log(1-pow(1-chi_not_a, N_not_a+m-1))
             + lgamma(N_not_a+1) - lgamma(N_not_a+m+1) + lgamma(N_a+1) - lgamma(N_a-m+1);
     }
+    else if (currentProposal.moveType == SixStepsHypergraphProposal::PAIR) {
+        logAcceptance += log(pairChooser->getReverseProbability({i, j}, currentProposal.move));
+        logAcceptance += -log(pairChooser->getForwardProbability({i, j}, currentProposal.move));
+    }
+    else if (currentProposal.moveType == SixStepsHypergraphProposal::SHIFT) {
+        if (currentProposal.chosenTriplet == currentProposal.shiftedTriplet)
+            return logAcceptance;
+        if (hypergraph.isTriangle(currentProposal.shiftedTriplet))
+            return -INFINITY;
+
+        const size_t& l = currentProposal.shiftedTriplet.k;
+        double totalWeight = getShiftTotalWeight();
+        logAcceptance += log(getShiftWeight(k)) - log(totalWeight-getShiftWeight(l));
+        logAcceptance += -log(getShiftWeight(l)) + log(totalWeight-getShiftWeight(k));
+    }
     else if (currentProposal.move == ADD) {
         if (currentProposal.moveType == SixStepsHypergraphProposal::EDGE) {
-            if (edgeNumber == maximumEdgeNumber-1)
-                logAcceptance += -log(eta);
-            else
-                logAcceptance += log(1-eta) - log(eta);
-
             logAcceptance += log(edgeRemover.getReverseProbability({i, j}, ADD));
             logAcceptance += -log(edgeAdder.getForwardProbability({i, j}, ADD));
         }
         else if (currentProposal.moveType == SixStepsHypergraphProposal::TRIANGLE) {
-            if (triangleNumber == maximumTriangleNumber-1)
-                logAcceptance += -log(eta);
-            else
-                logAcceptance += log(1-eta) - log(eta);
-
             logAcceptance += log(triangleRemover.getReverseProbability({i, j, k}, ADD));
             logAcceptance += -log(triangleAdder.getForwardProbability({i, j, k}, ADD));
         }
     }
     else if (currentProposal.move == REMOVE) {
         if (currentProposal.moveType == SixStepsHypergraphProposal::EDGE) {
-            if (edgeNumber == 1)
-                logAcceptance += -log(1-eta);
-            else
-                logAcceptance += log(eta) - log(1-eta);
-
             logAcceptance += log(edgeAdder.getReverseProbability({i, j}, REMOVE));
             logAcceptance += -log(edgeRemover.getForwardProbability({i, j}, REMOVE));
         }
         else if (currentProposal.moveType == SixStepsHypergraphProposal::TRIANGLE) {
-            if (triangleNumber == 1)
-                logAcceptance += -log(1-eta);
-            else
-                logAcceptance += log(eta) - log(1-eta);
-
             logAcceptance += log(triangleAdder.getReverseProbability({i, j, k}, REMOVE));
             logAcceptance += -log(triangleRemover.getForwardProbability({i, j, k}, REMOVE));
         }
@@ -215,7 +348,7 @@ bool HypergraphSixStepsProposer::applyStep(){
     const size_t& k = currentProposal.chosenTriplet.k;
 
 
-    if ( i!=j && currentProposal.moveType == SixStepsHypergraphProposal::EDGE) {
+    if ( i!=j && (currentProposal.moveType == SixStepsHypergraphProposal::EDGE || currentProposal.moveType == SixStepsHypergraphProposal::PAIR)) {
         edgeAdder.updateProbabilities({i, j}, currentProposal.move);
         edgeRemover.updateProbabilities({i, j}, currentProposal.move);
         if (currentProposal.move == ADD)
@@ -234,6 +367,19 @@ bool HypergraphSixStepsProposer::applyStep(){
                 hypergraphChanged = hypergraph.removeTriangle({i, j, k});
         }
     }
+    else if (currentProposal.moveType == SixStepsHypergraphProposal::SHIFT) {
+        const Triplet& shiftedTriplet = currentProposal.shiftedTriplet;
+
+        if (currentProposal.chosenTriplet != shiftedTriplet && !hypergraph.isTriangle(shiftedTriplet)) {
+            triangleAdder.  updateProbabilities({i, j, k}, REMOVE);
+            triangleRemover.updateProbabilities({i, j, k}, REMOVE);
+            hypergraph.removeTriangle({i, j, k});
+
+            triangleAdder.  updateProbabilities(shiftedTriplet, ADD);
+            triangleRemover.updateProbabilities(shiftedTriplet, ADD);
+            hypergraphChanged = hypergraph.addTriangle(shiftedTriplet);
+        }
+    }
     else if (currentProposal.moveType == SixStepsHypergraphProposal::HIDDEN_EDGES) {
         hypergraphChanged = true;
 
@@ -255,6 +401,56 @@ bool HypergraphSixStepsProposer::applyStep(){
     return hypergraphChanged;
 }
 
+// Index of the move type in the move probabilities
+static size_t getMoveProbabilityIndex(SixStepsHypergraphProposal::MoveType moveType) {
+    if (moveType == SixStepsHypergraphProposal::TRIANGLE)
+        return 0;
+    if (moveType == SixStepsHypergraphProposal::EDGE)
+        return 1;
+    if (moveType == SixStepsHypergraphProposal::HIDDEN_EDGES)
+        return 2;
+    if (moveType == SixStepsHypergraphProposal::PAIR)
+        return 3;
+    return 4;
+}
+
+void HypergraphSixStepsProposer::adaptToStep(double logAcceptance, bool hypergraphChanged) {
+    double squaredJump = 0;
+    if (hypergraphChanged)
+        squaredJump = currentProposal.moveType == SixStepsHypergraphProposal::HIDDEN_EDGES ?
+                            pow(currentProposal.changedPairs.size(), 2) : 1;
+
+    // Number of pairs whose observation likelihood is evaluated. Hidden edges moves go through
+    // every candidate pair before drawing the changed ones.
+    size_t evaluatedPairs = currentProposal.moveType == SixStepsHypergraphProposal::HIDDEN_EDGES ?
+                            currentProposal.maximumChangedPairsNumber : currentProposal.changedPairs.size();
+    double cost = std::max((size_t) 1, evaluatedPairs);
+
+    size_t moveIndex = getMoveProbabilityIndex(currentProposal.moveType);
+    bool etaIndependent = currentProposal.moveType == SixStepsHypergraphProposal::PAIR
+                            || currentProposal.moveType == SixStepsHypergraphProposal::SHIFT;
+    bool updated = etaIndependent ?
+        adaptation.recordStep(moveIndex, squaredJump, cost) :
+        adaptation.recordStep(moveIndex, currentProposal.move, logAcceptance-etaLogContribution, squaredJump, cost);
+    if (updated)
+        setMoveParameters(adaptation.getMoveProbabilities(), adaptation.getEta());
+}
+
+void HypergraphSixStepsProposer::setMoveParameters(const std::vector<double>& moveProbabilities, double eta) {
+    this->eta = eta;
+    addRemoveDistribution = std::bernoulli_distribution(eta);
+    moveTypeDistribution = std::discrete_distribution<int> {moveProbabilities.begin(), moveProbabilities.end()};
+}
+
+void HypergraphSixStepsProposer::writeState(std::ostream& stream) const {
+    adaptation.writeState(stream);
+}
+
+void HypergraphSixStepsProposer::readState(std::istream& stream) {
+    adaptation.readState(stream);
+    setMoveParameters(adaptation.getMoveProbabilities(), adaptation.getEta());
+}
+
 void HypergraphSixStepsProposer::recomputeProposersDistributions() {
     edgeAdder.recomputeDistribution();
     edgeRemover.recomputeDistribution();
@@ -7,6 +7,7 @@ EdgeTwoStepsProposer::EdgeTwoStepsProposer(Hypergraph& hypergraph, Parameters& p
         hypergraph(hypergraph),
         additionChooser(additionChooser), removalChooser(removalChooser),
         eta(eta),
+        adaptation({1}, eta),
         currentProposal({ REMOVE, {0, 0} })
 {}
 
@@ -14,12 +15,12 @@ EdgeTwoStepsProposer::EdgeTwoStepsProposer(Hypergraph& hypergraph, Parameters& p
         hypergraph(hypergraph),
         additionChooser(additionChooser), removalChooser(removalChooser),
         eta(eta),
+        adaptation({1}, eta),
         currentProposal({ REMOVE, {0, 0} })
 {}
 
 
 void EdgeTwoStepsProposer::generateProposal() {
-
     if (hypergraph.getEdgeNumber() == 0)
         currentProposal.move = ADD;
     else if (hypergraph.getEdgeNumber() == hypergraph.getMaximumEdgeNumber())
@@ -33,25 +34,29 @@ void EdgeTwoStepsProposer::generateProposal() {
         currentProposal.chosenEdge = additionChooser.choose();
     else
         currentProposal.chosenEdge = removalChooser.choose();
+
+    if (adapting)
+        etaLogContribution = getEtaLogContribution();
 }
 
-double EdgeTwoStepsProposer::getLogAcceptanceContribution() const {
-    double logAcceptance = 0;
+double EdgeTwoStepsProposer::getEtaLogContribution() const {
     if (currentProposal.move == ADD) {
         if (hypergraph.getEdgeNumber() == hypergraph.getMaximumEdgeNumber()-1)
-            logAcceptance += -log(eta);
-        else
-            logAcceptance += log(1-eta) - log(eta);
+            return -log(eta);
+        return log(1-eta) - log(eta);
+    }
+    if (hypergraph.getEdgeNumber() == 1)
+        return -log(1-eta);
+    return log(eta) - log(1-eta);
+}
 
+double EdgeTwoStepsProposer::getLogAcceptanceContribution() const {
+    double logAcceptance = getEtaLogContribution();
+    if (currentProposal.move == ADD) {
         logAcceptance += log(removalChooser.getReverseProbability(currentProposal.chosenEdge, currentProposal.move));
         logAcceptance += -log(additionChooser.getForwardProbability(currentProposal.chosenEdge, currentProposal.move));
     }
     else if (currentProposal.move == REMOVE) {
-        if (hypergraph.getEdgeNumber() == 1)
-            logAcceptance += -log(1-eta);
-        else
-            logAcceptance += log(eta) - log(1-eta);
-
         logAcceptance += log(additionChooser.getReverseProbability(currentProposal.chosenEdge, currentProposal.move));
         logAcceptance += -log(removalChooser.getForwardProbability(currentProposal.chosenEdge, currentProposal.move));
     }
@@ -80,6 +85,21 @@ void EdgeTwoStepsProposer::setProposal(Edge edge, AddRemoveMove move) {
     currentProposal.move = move;
 }
 
+void EdgeTwoStepsProposer::adaptToStep(double logAcceptance, bool hypergraphChanged) {
+    // A single move type, so only eta is adapted
+    if (adaptation.recordStep(0, currentProposal.move, logAcceptance-etaLogContribution, hypergraphChanged, 1))
+        eta = adaptation.getEta();
+}
+
+void EdgeTwoStepsProposer::writeState(std::ostream& stream) const {
+    adaptation.writeState(stream);
+}
+
+void EdgeTwoStepsProposer::readState(std::istream& stream) {
+    adaptation.readState(stream);
+    eta = adaptation.getEta();
+}
+
 void EdgeTwoStepsProposer::recomputeProposersDistributions() {
     additionChooser.recomputeDistribution();
     removalChooser.recomputeDistribution();
@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include "GRIT/sample_reader.h"
+#include "GRIT/sample_writer.h"
+
+
+namespace GRIT {
+using namespace std;
+
+
+static bool fileExists(const string& fileName) {
+    return ifstream(fileName).good();
+}
+
+static string getDirectoryPath(const string& directory) {
+    if (!directory.empty() && directory.back() != '/')
+        return directory+'/';
+    return directory;
+}
+
+ChainSampleReader::ChainSampleReader(const string& chainDirectory, size_t chain, size_t sampleSize,
+        const string& hypergraphPrefix, const string& parametersPrefix) {
+
+    string directory = getDirectoryPath(chainDirectory);
+
+    for (size_t i=0; i<sampleSize; i++) {
+        string suffix = to_string(chain)+"_"+to_string(i)+".bin";
+        string hypergraphPath = directory + hypergraphPrefix + suffix;
+        string parametersPath = directory + parametersPrefix + suffix;
+
+        bool hypergraphExists = fileExists(hypergraphPath)
+                                || (fileExists(hypergraphPath+"_edges") && fileExists(hypergraphPath+"_triangles"));
+        if (!hypergraphExists || !fileExists(parametersPath))
+            continue;
+
+        addSample(i, hypergraphPath);
+        readParameters(parametersPath);
+    }
+}
+
+void ChainSampleReader::addSample(size_t iteration, const string& hypergraphPath) {
+    Sample sample;
+    sample.iteration = iteration;
+    size_t sampleSize;
+
+    if (CompactHypergraphFile::isCompactHypergraph(hypergraphPath)) {
+        sample.file = make_shared<const CompactHypergraphFile>(hypergraphPath);
+        sample.edges = sample.file->getEdges();
+        sample.triangles = sample.file->getTriangles();
+        sample.edgeNumber = sample.file->getEdgeNumber();
+        sample.triangleNumber = sample.file->getTriangleNumber();
+        sampleSize = sample.file->getSize();
+    }
+    else {
+        auto hypergraph = Hypergraph::loadFromBinary(hypergraphPath);
+        sampleSize = hypergraph.getSize();
+
+        vector<CompactTriplet> edges, triangles;
+        for (Index i=0; i<sampleSize; i++) {
+            for (auto& neighbour_multiplicity_pair: hypergraph.getEdgesFrom(i))
+                if (i < neighbour_multiplicity_pair.first)
+                    edges.push_back({(uint32_t) i, (uint32_t) neighbour_multiplicity_pair.first, (uint32_t) neighbour_multiplicity_pair.second});
+
+            for (auto& triangleNeighbours: hypergraph.getTrianglesFrom(i))
+                if (i < triangleNeighbours.first)
+                    for (auto& k: triangleNeighbours.second)
+                        triangles.push_back({(uint32_t) i, (uint32_t) triangleNeighbours.first, (uint32_t) k});
+        }
+        sort(edges.begin(), edges.end());
+        sort(triangles.begin(), triangles.end());
+
+        sample.ownedEdges.resize(3*edges.size());
+        sample.ownedTriangles.resize(3*triangles.size());
+        memcpy(sample.ownedEdges.data(), edges.data(), edges.size()*sizeof(CompactTriplet));
+        memcpy(sample.ownedTriangles.data(), triangles.data(), triangles.size()*sizeof(CompactTriplet));
+
+        sample.edges = sample.ownedEdges.data();
+        sample.triangles = sample.ownedTriangles.data();
+        sample.edgeNumber = edges.size();
+        sample.triangleNumber = triangles.size();
+    }
+
+    if (samples.empty())
+        size = sampleSize;
+    else if (sampleSize != size)
+        throw runtime_error("Chain sample: \""+hypergraphPath+"\" doesn't have the same number of vertices as the previous samples.");
+
+    samples.push_back(std::move(sample));
+}
+
+void ChainSampleReader::readParameters(const string& parametersPath) {
+    ifstream fileStream(parametersPath, ios::in|ios::binary|ios::ate);
+    if (!fileStream.is_open()) throw runtime_error("The file \""+parametersPath+"\" could not be open to read parameters.");
+
+    size_t fileParameterNumber = fileStream.tellg()/sizeof(double);
+    if (parameters.empty())
+        parameterNumber = fileParameterNumber;
+    else if (fileParameterNumber != parameterNumber)
+        throw runtime_error("Chain sample: \""+parametersPath+"\" doesn't have the same number of parameters as the previous samples.");
+
+    size_t offset = parameters.size();
+    parameters.resize(offset+parameterNumber);
+    fileStream.seekg(0);
+    fileStream.read((char*) (parameters.data()+offset), parameterNumber*sizeof(double));
+}
+
+Hypergraph ChainSampleReader::getHypergraph(size_t sample) const {
+    const auto& _sample = samples.at(sample);
+
+    Hypergraph hypergraph(size);
+    hypergraph.addSortedEdges(_sample.edges, _sample.edgeNumber);
+    hypergraph.addSortedTriangles(_sample.triangles, _sample.triangleNumber);
+    return hypergraph;
+}
+
+void ChainSampleReader::fillPairTypes(int8_t* types, bool withCorrelation) const {
+    size_t pairNumber = nchoose2(size);
+
+    for (auto& sample: samples) {
+        fill(types, types+pairNumber, 0);
+
+        for (size_t n=0; n<sample.edgeNumber; n++) {
+            const uint32_t* edge = sample.edges+3*n;
+            types[getPairIndex(edge[0], edge[1], size)] = withCorrelation ? 1 : (int8_t) min<uint32_t>(edge[2], INT8_MAX);
+        }
+
+        if (withCorrelation)
+            for (size_t n=0; n<sample.triangleNumber; n++) {
+                const uint32_t* triangle = sample.triangles+3*n;
+                types[getPairIndex(triangle[0], triangle[1], size)] = 2;
+                types[getPairIndex(triangle[0], triangle[2], size)] = 2;
+                types[getPairIndex(triangle[1], triangle[2], size)] = 2;
+            }
+        types += pairNumber;
+    }
+}
+
+bool ChainSampleReader::hasOccurences(const string& chainDirectory, size_t chain) {
+    string directory = getDirectoryPath(chainDirectory);
+    return fileExists(getOccurencesFileName(directory, chain, 1)) && fileExists(getOccurencesFileName(directory, chain, 2));
+}
+
+static vector<size_t> readOccurencesMatrix(const string& fileName, size_t& size) {
+    ifstream fileStream(fileName, ios::in|ios::binary|ios::ate);
+    if (!fileStream.is_open()) throw runtime_error("The file \""+fileName+"\" could not be open to read occurences.");
+
+    size_t valueNumber = fileStream.tellg()/sizeof(size_t);
+    size = round(sqrt(valueNumber));
+    if (size*size != valueNumber)
+        throw runtime_error("Chain occurences: \""+fileName+"\" isn't a square matrix.");
+
+    vector<size_t> occurences(valueNumber);
+    fileStream.seekg(0);
+    fileStream.read((char*) occurences.data(), valueNumber*sizeof(size_t));
+    if (!fileStream)
+        throw runtime_error("Chain occurences: \""+fileName+"\" is truncated.");
+    return occurences;
+}
+
+EdgeTypeOccurences ChainSampleReader::readOccurences(const string& chainDirectory, size_t chain) {
+    string directory = getDirectoryPath(chainDirectory);
+    EdgeTypeOccurences occurences;
+    size_t edgetype2Size;
+    occurences.edgetype1 = readOccurencesMatrix(getOccurencesFileName(directory, chain, 1), occurences.size);
+    occurences.edgetype2 = readOccurencesMatrix(getOccurencesFileName(directory, chain, 2), edgetype2Size);
+    if (edgetype2Size != occurences.size)
+        throw runtime_error("Chain occurences: the edge type matrices of chain "+to_string(chain)+" don't have the same size.");
+
+    string sampleNumberFileName = getOccurencesSampleNumberFileName(directory, chain);
+    if (fileExists(sampleNumberFileName)) {
+        ifstream fileStream(sampleNumberFileName, ios::in|ios::binary);
+        readBinaryValue(fileStream, occurences.sampleNumber);
+        if (!fileStream)
+            throw runtime_error("Chain occurences: \""+sampleNumberFileName+"\" is truncated.");
+    }
+    return occurences;
+}
+
+} //namespace GRIT
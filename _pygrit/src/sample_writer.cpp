@@ -0,0 +1,179 @@
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+#include "GRIT/sample_writer.h"
+#include "GRIT/compact_format.h"
+
+
+namespace GRIT {
+using namespace std;
+
+
+HypergraphSnapshot::HypergraphSnapshot(const Hypergraph& hypergraph): size(hypergraph.getSize()) {
+    edges.reserve(hypergraph.getEdgeNumber());
+    triangles.reserve(hypergraph.getTriangleNumber());
+
+    for (Index i=0; i<size; i++) {
+        for (auto& neighbour_multiplicity_pair: hypergraph.getEdgesFrom(i))
+            if (i < neighbour_multiplicity_pair.first)
+                edges.push_back({i, neighbour_multiplicity_pair.first, neighbour_multiplicity_pair.second});
+
+        for (auto& triangleNeighbours: hypergraph.getTrianglesFrom(i)) {
+            auto& j = triangleNeighbours.first;
+            if (i < j)
+                for (auto& k: triangleNeighbours.second)
+                    triangles.push_back({i, j, k});
+        }
+    }
+}
+
+void writeChainOccurences(const SparseMatrix<size_t>& edgetype1, const SparseMatrix<size_t>& edgetype2, size_t sampleNumber,
+        const string& directory, size_t chain) {
+    writeSparseMatrixToBinary<size_t>(edgetype1, getOccurencesFileName(directory, chain, 1));
+    writeSparseMatrixToBinary<size_t>(edgetype2, getOccurencesFileName(directory, chain, 2));
+
+    string fileName = getOccurencesSampleNumberFileName(directory, chain);
+    ofstream fileStream(fileName, ios::out|ios::binary);
+    if (!fileStream.is_open()) throw runtime_error("The file \""+fileName+"\" could not be open to save the sample number.");
+    writeBinaryValue(fileStream, sampleNumber);
+}
+
+void HypergraphSnapshot::writeToBinary(const string& filePrefix) const {
+    writeTrianglesToBinary(filePrefix + "_triangles");
+    writeEdgesToBinary(filePrefix + "_edges");
+}
+
+void HypergraphSnapshot::writeTrianglesToBinary(const string& fileName) const {
+    ofstream fileStream(fileName, ios::out|ios::binary);
+    if (!fileStream.is_open()) throw runtime_error("The file \""+fileName+"\" could not be open to save the triangle list.");
+
+    // Every triangle is listed from each of its vertices, grouped by vertex (see TriangleList::writeToBinary)
+    vector<size_t> listLengths(size, 0);
+    for (auto& triangle: triangles) {
+        listLengths[triangle.i]++;
+        listLengths[triangle.j]++;
+        listLengths[triangle.k]++;
+    }
+    vector<size_t> listOffsets(size+1, 0);
+    for (size_t i=0; i<size; i++)
+        listOffsets[i+1] = listOffsets[i] + listLengths[i];
+
+    vector<Index> pairs(2*listOffsets[size]);
+    auto addPair = [&](Index vertex, Index j, Index k) {
+        size_t& position = listOffsets[vertex];
+        pairs[2*position] = j;
+        pairs[2*position+1] = k;
+        position++;
+    };
+    for (auto& triangle: triangles) {
+        addPair(triangle.i, triangle.j, triangle.k);
+        addPair(triangle.j, triangle.i, triangle.k);
+        addPair(triangle.k, triangle.i, triangle.j);
+    }
+
+    fileStream.write((char*) &size, sizeof(size_t));
+    fileStream.write((char*) listLengths.data(), size*sizeof(size_t));
+    fileStream.write((char*) pairs.data(), pairs.size()*sizeof(Index));
+}
+
+void HypergraphSnapshot::writeEdgesToBinary(const string& fileName) const {
+    ofstream fileStream(fileName, ios::out|ios::binary);
+    if (!fileStream.is_open()) throw runtime_error("The file \""+fileName+"\" could not be open to save the edge list.");
+
+    fileStream.write((char*) &size, sizeof(size_t));
+    fileStream.write((char*) edges.data(), edges.size()*sizeof(edges[0]));
+}
+
+void HypergraphSnapshot::writeToCompactBinary(const string& fileName, bool compress) const {
+    vector<CompactTriplet> compactEdges, compactTriangles;
+    compactEdges.reserve(edges.size());
+    compactTriangles.reserve(triangles.size());
+
+    for (auto& edge: edges)
+        compactEdges.push_back({(uint32_t) edge[0], (uint32_t) edge[1], (uint32_t) edge[2]});
+    for (auto& triangle: triangles)
+        compactTriangles.push_back({(uint32_t) triangle.i, (uint32_t) triangle.j, (uint32_t) triangle.k});
+
+    writeCompactHypergraph(fileName, size, std::move(compactEdges), std::move(compactTriangles), compress);
+}
+
+
+AsyncSampleWriter::AsyncSampleWriter(size_t capacity): capacity(capacity) {
+    if (capacity == 0)
+        throw logic_error("The sample writer queue must hold at least one sample.");
+    worker = thread(&AsyncSampleWriter::writeSamples, this);
+}
+
+AsyncSampleWriter::~AsyncSampleWriter() {
+    {
+        lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+    }
+    queueNotEmpty.notify_one();
+    worker.join();  // Remaining samples are written before the thread exits
+
+    if (writerError)
+        fprintf(stderr, "Error: some samples could not be written to disk.\n");
+}
+
+void AsyncSampleWriter::push(SampleSnapshot&& sample) {
+    unique_lock<std::mutex> lock(mutex);
+    rethrowWriterError();
+
+    queueNotFull.wait(lock, [this] { return queue.size() < capacity; });
+    queue.push_back(std::move(sample));
+    lock.unlock();
+    queueNotEmpty.notify_one();
+}
+
+void AsyncSampleWriter::flush() {
+    unique_lock<std::mutex> lock(mutex);
+    queueDrained.wait(lock, [this] { return queue.empty() && !writing; });
+    rethrowWriterError();
+}
+
+void AsyncSampleWriter::rethrowWriterError() {
+    if (writerError) {
+        auto error = writerError;
+        writerError = nullptr;
+        rethrow_exception(error);
+    }
+}
+
+void AsyncSampleWriter::writeSamples() {
+    unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        queueNotEmpty.wait(lock, [this] { return stopRequested || !queue.empty(); });
+        if (queue.empty())
+            break;
+
+        SampleSnapshot sample = std::move(queue.front());
+        queue.pop_front();
+        writing = true;
+        lock.unlock();
+        queueNotFull.notify_one();
+
+        try {
+            if (sample.format == SampleFormat::SEPARATE_FILES)
+                sample.hypergraph.writeToBinary(sample.hypergraphFileName);
+            else
+                sample.hypergraph.writeToCompactBinary(sample.hypergraphFileName, sample.format == SampleFormat::COMPRESSED);
+            writeParametersToBinary(sample.parameters, sample.parametersFileName);
+        }
+        catch (...) {
+            lock.lock();
+            if (!writerError)
+                writerError = current_exception();
+            lock.unlock();
+        }
+
+        lock.lock();
+        writing = false;
+        if (queue.empty())
+            queueDrained.notify_all();
+    }
+}
+
+} //namespace GRIT
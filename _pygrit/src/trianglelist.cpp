@@ -176,6 +176,56 @@ bool TriangleList::isPairCoveredExluding(const Index& i, const Index& j, const T
     return covered;
 }
 
+// triangles[b][a] holds the third vertices x>a of the triangles covering (a, b) with a<b.
+// The triangles (x, a, b) with x<a are found in triangles[a][x], which is shared by the pairs (i, j) and (i, k).
+std::array<bool, 3> TriangleList::getTripletPairsCoverage(const Triplet& orderedTriplet, bool excludeTriplet) const {
+    const Index& i = orderedTriplet.i;
+    const Index& j = orderedTriplet.j;
+    const Index& k = orderedTriplet.k;
+    const auto& triangles_i = triangles[i];
+    const auto& triangles_j = triangles[j];
+    const auto& triangles_k = triangles[k];
+
+    std::array<bool, 3> covered {false, false, false};
+
+    auto it = triangles_j.find(i);
+    if (it != triangles_j.end())
+        covered[0] = it->second.size() > 1 || *it->second.begin() != k;
+
+    it = triangles_k.find(i);
+    if (it != triangles_k.end()) {
+        covered[1] = it->second.size() > 1 || *it->second.begin() != j;
+        if (!excludeTriplet && it->second.find(j) != it->second.end())
+            return {true, true, true};
+    }
+    covered[2] = triangles_k.find(j) != triangles_k.end();
+
+    if (!covered[0] || !covered[1]) {
+        for (auto& triangleNeighbours: triangles_i) {
+            if (triangleNeighbours.first > i)
+                continue;
+            auto& thirdVertices = triangleNeighbours.second;
+            covered[0] = covered[0] || thirdVertices.find(j) != thirdVertices.end();
+            covered[1] = covered[1] || thirdVertices.find(k) != thirdVertices.end();
+            if (covered[0] && covered[1])
+                break;
+        }
+    }
+    if (!covered[2]) {
+        bool neighbourhoodOf_j_isSmaller = triangles_j.size() < triangles_k.size();
+        Index otherVertex = neighbourhoodOf_j_isSmaller ? k : j;
+
+        for (auto& triangleNeighbours: neighbourhoodOf_j_isSmaller ? triangles_j : triangles_k) {
+            const Index& x = triangleNeighbours.first;
+            if (x < j && x != i && triangleNeighbours.second.find(otherVertex) != triangleNeighbours.second.end()) {
+                covered[2] = true;
+                break;
+            }
+        }
+    }
+    return covered;
+}
+
 size_t TriangleList::getTriangleNumberWith(const Index& vertex) const {
     size_t adjacentTriangleNumber = 0;
     for (auto& triangleNeighbours: getTrianglesFrom(vertex))
@@ -246,7 +296,7 @@ void TriangleList::writeToBinary(const string &fileName) const{
 
 TriangleList TriangleList::loadFromBinary(const string &fileName){
     ifstream fileStream(fileName.c_str(), ios::in | ios::binary);
-    if (!fileStream.is_open()) throw runtime_error("The file could not be open to save the triangle list.");
+    if (!fileStream.is_open()) throw runtime_error("The file \""+fileName+"\" could not be open to load the triangle list.");
 
     // Header
     // First 64 bits contain the size
@@ -255,8 +305,8 @@ TriangleList TriangleList::loadFromBinary(const string &fileName){
     TriangleList returnedObject(size);
 
     // Sequence of length "size" containing the length in 64 bits of every list of triangles
-    size_t listLengths[size];
-    fileStream.read((char*) &listLengths, size*sizeof(size_t));
+    vector<size_t> listLengths(size);
+    fileStream.read((char*) listLengths.data(), size*sizeof(size_t));
 
     // Sequence of length 2*triangleNumber of 64 bits with all the indices
     Index triplet_i = 0;
@@ -268,6 +318,7 @@ TriangleList TriangleList::loadFromBinary(const string &fileName){
         while ( listIndex >= listLengths[triplet_i] ) {
             listIndex = 0;
             triplet_i++;
+            if (triplet_i >= size) throw runtime_error("The triangle list file \""+fileName+"\" contains more triangles than announced.");
         }
         returnedObject.addTriangle({triplet_i, triplet_jk[0], triplet_jk[1]});
         elementsAdded++;
@@ -203,20 +203,129 @@ double drawFromTruncatedGammaITS(double inf, double sup, double k, double theta)
     return -1;
 }
 
-double drawFromTruncatedGamma(double inf, double sup, double k, double theta, size_t maxit) {
-    double rejectionProbability = inf>0 ?
-        boost::math::gamma_p(k, inf/theta) + boost::math::gamma_q(k, sup/theta) :
-        boost::math::gamma_q(k, sup/theta);
+// Distance z in [0, length] drawn with a density proportional to exp(-rate*z)
+static double drawTruncatedExponential(double rate, double length) {
+    double u = uniform_real_distribution<double>(0, 1)(generator);
+    return std::min(-log1p(u*expm1(-rate*length))/rate, length);
+}
 
-    double sample=-1;
-    if (rejectionProbability < .5/maxit)
-        sample = drawTruncatedGammaWithGammaRS(inf, sup, k, theta, maxit);
+// Integral of exp(-rate*z) over [0, length]
+static double getTruncatedExponentialWeight(double rate, double length) {
+    return -expm1(-rate*length)/rate;
+}
 
-    if (sample == -1)
-        sample = drawFromTruncatedGammaITS(inf, sup, k, theta);
+// Standard gamma y^(k-1)e^(-y) on [a, b] with k>=1, which is log-concave.
+// The envelope is exp(h(m)) between the points where h drops by 1 from its maximum h(m) in [a, b],
+// and the tangents to h at these points outside of them.
+static double drawLogConcaveStandardTruncatedGamma(double a, double b, double k, size_t maxit) {
+    auto h = [&](double y) { return k == 1 ? -y : (k-1)*log(y) - y; };
+    auto dh = [&](double y) { return (k-1)/y - 1; };
+
+    const double mode = std::min(std::max(k-1, a), b);
+    const double hMax = h(mode);
+    const double spread = std::max(sqrt(2*(k-1)), 1.);
+    const size_t newtonSteps = 10;
+
+    // The envelope is valid for any left<=mode<=right. The Newton iterations on h-hMax+1 only improve its efficiency.
+    double left = mode;
+    if (mode > a && h(a) < hMax-1) {
+        left = mode/2;
+        for (size_t i=0; i<64 && h(left) >= hMax-1; i++)
+            left /= 2;
+        left = std::max(left, a);
+        for (size_t i=0; i<newtonSteps && h(left) < hMax-1; i++)
+            left = std::min(left - (h(left)-hMax+1)/dh(left), mode);
+    }
+    else
+        left = a;
+
+    double right = b;
+    if (mode < b) {
+        right = mode+spread;
+        for (size_t i=0; i<newtonSteps && right < b; i++) {
+            double next = right - (h(right)-hMax+1)/dh(right);
+            if (!(next > mode))
+                break;
+            right = next;
+        }
+        right = std::min(right, b);
+    }
 
-    if (sample == -1)
-        sample = drawTruncatedGammaWithLinearRS(inf, sup, k, theta, maxit);
+    const double leftRate = left > a ? dh(left) : 1;
+    const double rightRate = right < b ? -dh(right) : 1;
+    const double weights[3] = {
+        left > a  ? exp(h(left)-hMax)*getTruncatedExponentialWeight(leftRate, left-a) : 0,
+        right-left,
+        right < b ? exp(h(right)-hMax)*getTruncatedExponentialWeight(rightRate, b-right) : 0
+    };
+    discrete_distribution<int> pieceDistribution(weights, weights+3);
+    uniform_real_distribution<double> uniform01Distribution(0, 1);
+
+    for (size_t i=0; i<maxit; i++) {
+        double y, logEnvelope;
+        int piece = pieceDistribution(generator);
+        if (piece == 0) {
+            y = left - drawTruncatedExponential(leftRate, left-a);
+            logEnvelope = h(left) - leftRate*(left-y);
+        }
+        else if (piece == 1) {
+            y = uniform01Distribution(generator)*(right-left) + left;
+            logEnvelope = hMax;
+        }
+        else {
+            y = right + drawTruncatedExponential(rightRate, b-right);
+            logEnvelope = h(right) - rightRate*(y-right);
+        }
+        if (y > 0 && log(uniform01Distribution(generator)) < h(y)-logEnvelope)
+            return y;
+    }
+    return -1;
+}
+
+// Standard gamma y^(k-1)e^(-y) on [a, b] with k<1, which is decreasing.
+// The envelope is y^(k-1)e^(-a) on [a, c] and c^(k-1)e^(-y) on [c, b] with c=1 clipped to [a, b].
+// Each piece accepts with probability above exp(-1).
+static double drawDecreasingStandardTruncatedGamma(double a, double b, double k, size_t maxit) {
+    const double c = std::min(std::max(a, 1.), b);
+    const double weights[2] = {
+        (pow(c, k)-pow(a, k))/k,
+        pow(c, k-1)*exp(a-c)*getTruncatedExponentialWeight(1, b-c)
+    };
+    discrete_distribution<int> pieceDistribution(weights, weights+2);
+    uniform_real_distribution<double> uniform01Distribution(0, 1);
+
+    for (size_t i=0; i<maxit; i++) {
+        double y, u = uniform01Distribution(generator);
+        bool accepted;
+        if (pieceDistribution(generator) == 0) {
+            y = pow(pow(a, k) + uniform01Distribution(generator)*(pow(c, k)-pow(a, k)), 1/k);
+            accepted = u < exp(a-y);
+        }
+        else {
+            y = c + drawTruncatedExponential(1, b-c);
+            accepted = u < pow(y/c, k-1);
+        }
+        if (accepted && y > 0)
+            return std::min(std::max(y, a), b);
+    }
+    return -1;
+}
+
+double drawTruncatedGammaWithEnvelopeRS(double inf, double sup, double k, double theta, size_t maxit) {
+    if (sup <= inf)
+        throw std::logic_error("Upper bound of truncated distribution must be superior to the lower bound");
+    if (k <= 0 || theta <= 0)
+        throw std::logic_error("Gamma distribution parameters must be positive");
+
+    double a = std::max(inf, 0.)/theta, b = sup/theta;
+    double sample = k < 1 ?
+        drawDecreasingStandardTruncatedGamma(a, b, k, maxit) :
+        drawLogConcaveStandardTruncatedGamma(a, b, k, maxit);
+    return sample == -1 ? -1 : sample*theta;
+}
+
+double drawFromTruncatedGamma(double inf, double sup, double k, double theta, size_t maxit) {
+    double sample = drawTruncatedGammaWithEnvelopeRS(inf, sup, k, theta, maxit);
 
     if (sample == -1)
         throw runtime_error("Could not sample from the truncated gamma distribution ["+to_string(inf)+", "+to_string(sup)+"] with parameters"+
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "GRIT/utility.h"
+#include "GRIT/hypergraph.h"
+#include "GRIT/average_hypergraph.h"
+
+
+using namespace std;
+using namespace GRIT;
+
+
+static vector<Hypergraph> getSample() {
+    vector<Hypergraph> sample(4, Hypergraph(6));
+    for (size_t i=0; i<4; i++) {
+        sample[i].addEdge(0, 1);
+        sample[i].addTriangle({2, 3, 4});
+    }
+    sample[0].addEdge(4, 5);
+    sample[1].addEdge(4, 5);
+    sample[2].addEdge(1, 2);
+    sample[0].addTriangle({0, 1, 5});
+    sample[1].addMultiedge(2, 5, 2);
+    sample[2].addMultiedge(2, 5, 2);
+    sample[3].addEdge(2, 5);
+    return sample;
+}
+
+
+TEST(AverageHypergraphAccumulator, when_hyperedgesInHalfOfSample_expect_inAverageHypergraph) {
+    AverageHypergraphAccumulator accumulator;
+    for (auto& hypergraph: getSample())
+        accumulator.add(hypergraph);
+    auto average = accumulator.getAverageHypergraph();
+
+    EXPECT_EQ(accumulator.getSampleSize(), 4);
+    EXPECT_EQ(average.getEdgeNumber(), 3);
+    EXPECT_TRUE(average.isEdge(0, 1));
+    EXPECT_TRUE(average.isEdge(4, 5));
+    EXPECT_TRUE(average.isEdge(2, 5));
+    EXPECT_EQ(average.getTriangleNumber(), 1);
+    EXPECT_TRUE(average.isTriangle({2, 3, 4}));
+}
+
+TEST(AverageHypergraphAccumulator, when_edgeStrength_expect_weakAndStrongEdgesCountedSeparately) {
+    AverageHypergraphAccumulator accumulator(true);
+    for (auto& hypergraph: getSample())
+        accumulator.add(hypergraph);
+    auto average = accumulator.getAverageHypergraph(0.75);
+
+    EXPECT_EQ(average.getEdgeMultiplicity(0, 1), 1);
+    EXPECT_EQ(average.getEdgeMultiplicity(4, 5), 0);
+    EXPECT_EQ(average.getEdgeMultiplicity(2, 5), 0);
+    EXPECT_EQ(average.getTriangleNumber(), 0);
+    EXPECT_EQ(accumulator.getAverageHypergraph(0.5).getEdgeMultiplicity(2, 5), 2);
+}
+
+TEST(AverageHypergraphAccumulator, when_mergingPartialAccumulators_expect_sameAverage) {
+    auto sample = getSample();
+    AverageHypergraphAccumulator all, first, second;
+    for (size_t i=0; i<sample.size(); i++) {
+        all.add(sample[i]);
+        (i%2 == 0 ? first : second).add(sample[i]);
+    }
+    first.merge(second);
+
+    EXPECT_EQ(first.getSampleSize(), all.getSampleSize());
+    for (double threshold: {0.25, 0.5, 1.}) {
+        auto merged = first.getAverageHypergraph(threshold), expected = all.getAverageHypergraph(threshold);
+        EXPECT_EQ(merged.getEdgeNumber(), expected.getEdgeNumber());
+        EXPECT_EQ(merged.getTriangleNumber(), expected.getTriangleNumber());
+        EXPECT_EQ(merged.getFullTriangleList(), expected.getFullTriangleList());
+    }
+}
+
+TEST(AverageHypergraphAccumulator, when_differentSizes_expect_logicError) {
+    AverageHypergraphAccumulator accumulator;
+    accumulator.add(Hypergraph(5));
+    EXPECT_THROW(accumulator.add(Hypergraph(6)), logic_error);
+}
+
+TEST(accumulateHypergraphFiles, when_filesLoadedByThreads_expect_averageOfSample) {
+    auto sample = getSample();
+    vector<string> fileNames;
+    for (size_t i=0; i<sample.size(); i++) {
+        fileNames.push_back("average_hypergraph_test"+to_string(i));
+        sample[i].writeToBinary(fileNames.back());
+    }
+
+    for (size_t threadNumber: {1, 3}) {
+        auto accumulator = accumulateHypergraphFiles(fileNames, false, threadNumber);
+        auto average = accumulator.getAverageHypergraph();
+        EXPECT_EQ(accumulator.getSampleSize(), 4);
+        EXPECT_EQ(average.getEdgeNumber(), 3);
+        EXPECT_TRUE(average.isTriangle({2, 3, 4}));
+        EXPECT_EQ(average.getTriangleNumber(), 1);
+    }
+    for (auto& fileName: fileNames) {
+        remove((fileName+"_edges").c_str());
+        remove((fileName+"_triangles").c_str());
+    }
+}
@@ -57,15 +57,26 @@ slope = -0.3
 p = 0.1
 trunc_bound = [0.1, 1]
 inf, sup = 5, 10
+tail_inf, tail_sup = 10, 15
+small_a = 0.3
 
 # grit.sample_from_truncgamma
 setups = [("trunc gamma", [
                     (pygrit.sample_from_truncgamma_its, (*trunc_bound, a, b), "ITS"),
                     (pygrit.sample_from_truncgamma_gamma_rs, (*trunc_bound, a, b, maxit), "Gamma RS"),
                     (pygrit.sample_from_truncgamma_uniform_rs, (*trunc_bound, a, b, maxit), "Uniform RS"),
-                    (pygrit.sample_from_truncgamma_linear_rs, (*trunc_bound, a, b, maxit), "Linear RS")
+                    (pygrit.sample_from_truncgamma_linear_rs, (*trunc_bound, a, b, maxit), "Linear RS"),
+                    (pygrit.sample_from_truncgamma_envelope_rs, (*trunc_bound, a, b, maxit), "Envelope RS")
                 ],
                 truncgamma(*trunc_bound, a, b)),
+          ("trunc gamma tail", [
+                    (pygrit.sample_from_truncgamma_envelope_rs, (tail_inf, tail_sup, a, b, maxit), "Envelope RS")
+                ],
+                truncgamma(tail_inf, tail_sup, a, b)),
+          ("trunc gamma k<1", [
+                    (pygrit.sample_from_truncgamma_envelope_rs, (*trunc_bound, small_a, b, maxit), "Envelope RS")
+                ],
+                truncgamma(*trunc_bound, small_a, b)),
           ("linear", [
               (pygrit.sample_from_linear, (*trunc_bound, slope), "ITS")
               ],
@@ -0,0 +1,238 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdio>
+#include <map>
+
+#include "GRIT/utility.h"
+#include "GRIT/hypergraph.h"
+#include "GRIT/occupancy.h"
+#include "fixtures.h"
+
+
+using namespace std;
+using namespace GRIT;
+
+
+static const string checkpointFileName = "test_checkpoint.bin";
+
+
+struct CheckpointedPHGPipeline: public PHGPipeline {
+    CheckpointedPHGPipeline(const Hypergraph& initialHypergraph, const Parameters& initialParameters):
+        PHGPipeline(initialHypergraph, initialParameters)
+    {
+        sampler.checkpointFileName = checkpointFileName;
+        sampler.canonicalizationInterval = 2;
+    }
+};
+
+static SampleSink recordSamplesIn(vector<ChainSample>& samples) {
+    return [&samples](const ChainSample& sample) { samples.push_back(sample); return false; };
+}
+
+static void expectSameHypergraphs(const Hypergraph& hypergraph1, const Hypergraph& hypergraph2) {
+    ASSERT_EQ(hypergraph1.getSize(), hypergraph2.getSize());
+    for (size_t i=0; i<hypergraph1.getSize(); i++)
+        for (size_t j=i+1; j<hypergraph1.getSize(); j++) {
+            EXPECT_EQ(hypergraph1.getEdgeMultiplicity(i, j), hypergraph2.getEdgeMultiplicity(i, j));
+            for (size_t k=j+1; k<hypergraph1.getSize(); k++)
+                EXPECT_EQ(hypergraph1.isTriangle({i, j, k}), hypergraph2.isTriangle({i, j, k}));
+        }
+}
+
+
+TEST(Checkpoint, resumeAndGetOccurences_fromCheckpoint_chainContinuesIdentically) {
+    Hypergraph initialHypergraph(8);
+    initialHypergraph.addTriangle({0, 1, 2});
+    initialHypergraph.addEdge(3, 4);
+    const Parameters initialParameters {0.1, 0.2, 0.5, 5, 10};
+
+    generator.seed(42);
+    CheckpointedPHGPipeline fullRun(initialHypergraph, initialParameters);
+    fullRun.sampler.checkpointInterval = 2;
+    vector<ChainSample> fullRunSamples;
+    fullRun.sampler.sampleSink = recordSamplesIn(fullRunSamples);
+    auto fullRunOccurences = fullRun.sampler.sampleAndGetOccurences(4, 2);
+
+    // Checkpoints were written after iterations 2 and 4: the resumed chain starts at the third sample
+    generator.seed(7);
+    CheckpointedPHGPipeline resumedRun(Hypergraph(8), {0.5, 0.5, 1, 1, 1});
+    vector<ChainSample> resumedRunSamples;
+    resumedRun.sampler.sampleSink = recordSamplesIn(resumedRunSamples);
+    auto resumedRunOccurences = resumedRun.sampler.resumeAndGetOccurences(4, 2);
+
+    ASSERT_EQ(fullRunSamples.size(), 4);
+    ASSERT_EQ(resumedRunSamples.size(), 2);
+    for (size_t i=0; i<2; i++) {
+        const auto& expectedSample = fullRunSamples[i+2];
+        const auto& resumedSample = resumedRunSamples[i];
+        EXPECT_EQ(resumedSample.iteration, expectedSample.iteration);
+        EXPECT_EQ(resumedSample.parameters, expectedSample.parameters);
+        expectSameHypergraphs(*resumedSample.hypergraph, *expectedSample.hypergraph);
+    }
+    EXPECT_EQ(resumedRunOccurences, fullRunOccurences);
+    EXPECT_EQ(resumedRun.sampler.getAverageLogLikelihood(), fullRun.sampler.getAverageLogLikelihood());
+
+    remove(checkpointFileName.c_str());
+}
+
+TEST(Checkpoint, resumeAndGetOccurences_withConvergenceMonitor_diagnosticsOfWholeChain) {
+    generator.seed(42);
+    CheckpointedPHGPipeline fullRun(Hypergraph(8), {0.1, 0.2, 0.5, 5, 10});
+    fullRun.sampler.checkpointInterval = 2;
+    fullRun.sampler.convergenceMonitor = make_shared<ConvergenceMonitor>();
+    fullRun.sampler.sampleAndGetOccurences(4, 2);
+
+    CheckpointedPHGPipeline resumedRun(Hypergraph(8), {0.5, 0.5, 1, 1, 1});
+    resumedRun.sampler.convergenceMonitor = make_shared<ConvergenceMonitor>();
+    resumedRun.sampler.resumeAndGetOccurences(4, 2);
+
+    auto fullRunDiagnostics = fullRun.sampler.convergenceMonitor->getDiagnostics(0);
+    auto resumedRunDiagnostics = resumedRun.sampler.convergenceMonitor->getDiagnostics(0);
+    ASSERT_EQ(resumedRunDiagnostics.size(), fullRunDiagnostics.size());
+    for (size_t i=0; i<fullRunDiagnostics.size(); i++) {
+        EXPECT_EQ(resumedRunDiagnostics[i].sampleSize, 4);
+        EXPECT_EQ(resumedRunDiagnostics[i].mean, fullRunDiagnostics[i].mean);
+    }
+    EXPECT_EQ(resumedRun.sampler.getOccurencesSampleNumber(), 4);
+
+    remove(checkpointFileName.c_str());
+}
+
+TEST(Checkpoint, resumeAndGetOccurences_withOccupancyAccumulator_occupanciesOfWholeChain) {
+    generator.seed(42);
+    CheckpointedPHGPipeline fullRun(Hypergraph(8), {0.1, 0.2, 0.5, 5, 10});
+    OccupancyAccumulator fullRunAccumulator(fullRun.hypergraph, true);
+    fullRun.hypergraphSampler.setOccupancyAccumulator(&fullRunAccumulator);
+    fullRun.sampler.occupancyAccumulator = &fullRunAccumulator;
+    fullRun.sampler.checkpointInterval = 2;
+    fullRun.sampler.sampleAndGetOccurences(4, 2);
+
+    CheckpointedPHGPipeline resumedRun(Hypergraph(8), {0.5, 0.5, 1, 1, 1});
+    OccupancyAccumulator resumedRunAccumulator(resumedRun.hypergraph, true);
+    resumedRun.hypergraphSampler.setOccupancyAccumulator(&resumedRunAccumulator);
+    resumedRun.sampler.occupancyAccumulator = &resumedRunAccumulator;
+    resumedRun.sampler.resumeAndGetOccurences(4, 2);
+
+    auto getSortedTriangleOccupancies = [](const OccupancyAccumulator& accumulator) {
+        map<array<Index, 3>, size_t> occupancies;
+        for (auto& triplet_steps: accumulator.getTriangleOccupancies())
+            occupancies[{triplet_steps.first.i, triplet_steps.first.j, triplet_steps.first.k}] = triplet_steps.second;
+        return occupancies;
+    };
+    EXPECT_GT(fullRunAccumulator.getStepNumber(), 0);
+    EXPECT_EQ(resumedRunAccumulator.getStepNumber(), fullRunAccumulator.getStepNumber());
+    EXPECT_EQ(resumedRunAccumulator.getPairOccupancies(), fullRunAccumulator.getPairOccupancies());
+    EXPECT_EQ(getSortedTriangleOccupancies(resumedRunAccumulator), getSortedTriangleOccupancies(fullRunAccumulator));
+
+    remove(checkpointFileName.c_str());
+}
+
+TEST(Checkpoint, sampleAndGetOccurences_withCheckpoints_sameChainAsWithout) {
+    Hypergraph initialHypergraph(8);
+    initialHypergraph.addTriangle({0, 1, 2});
+    const Parameters initialParameters {0.1, 0.2, 0.5, 5, 10};
+
+    generator.seed(42);
+    CheckpointedPHGPipeline checkpointedRun(initialHypergraph, initialParameters);
+    checkpointedRun.sampler.checkpointInterval = 2;
+    vector<ChainSample> checkpointedRunSamples;
+    checkpointedRun.sampler.sampleSink = recordSamplesIn(checkpointedRunSamples);
+    auto checkpointedRunOccurences = checkpointedRun.sampler.sampleAndGetOccurences(6, 2);
+
+    generator.seed(42);
+    CheckpointedPHGPipeline plainRun(initialHypergraph, initialParameters);
+    vector<ChainSample> plainRunSamples;
+    plainRun.sampler.sampleSink = recordSamplesIn(plainRunSamples);
+    auto plainRunOccurences = plainRun.sampler.sampleAndGetOccurences(6, 2);
+
+    ASSERT_EQ(checkpointedRunSamples.size(), plainRunSamples.size());
+    for (size_t i=0; i<plainRunSamples.size(); i++) {
+        EXPECT_EQ(checkpointedRunSamples[i].parameters, plainRunSamples[i].parameters);
+        expectSameHypergraphs(*checkpointedRunSamples[i].hypergraph, *plainRunSamples[i].hypergraph);
+    }
+    EXPECT_EQ(checkpointedRunOccurences, plainRunOccurences);
+
+    remove(checkpointFileName.c_str());
+}
+
+TEST(Checkpoint, resumeAndGetOccurences_withAdaptiveMoves_chainContinuesIdentically) {
+    // The burn-in is long enough for the move parameters to be updated several times
+    const size_t burnin = 1500;
+    const Parameters initialParameters {0.1, 0.2, 0.5, 5, 10};
+
+    generator.seed(42);
+    CheckpointedPHGPipeline fullRun(Hypergraph(8), initialParameters);
+    fullRun.sampler.checkpointInterval = 2;
+    fullRun.sampler.adaptiveMoves = true;
+    vector<ChainSample> fullRunSamples;
+    fullRun.sampler.sampleSink = recordSamplesIn(fullRunSamples);
+    auto fullRunOccurences = fullRun.sampler.sampleAndGetOccurences(4, burnin);
+
+    generator.seed(7);
+    CheckpointedPHGPipeline resumedRun(Hypergraph(8), {0.5, 0.5, 1, 1, 1});
+    resumedRun.sampler.adaptiveMoves = true;
+    vector<ChainSample> resumedRunSamples;
+    resumedRun.sampler.sampleSink = recordSamplesIn(resumedRunSamples);
+    auto resumedRunOccurences = resumedRun.sampler.resumeAndGetOccurences(4, burnin);
+
+    auto moveParameters = fullRun.sampler.getMoveParameters();
+    EXPECT_NE(moveParameters.moveProbabilities, vector<double>({0.45, 0.45, 0.1}));
+    EXPECT_EQ(resumedRun.sampler.getMoveParameters().moveProbabilities, moveParameters.moveProbabilities);
+    EXPECT_EQ(resumedRun.sampler.getMoveParameters().eta, moveParameters.eta);
+
+    ASSERT_EQ(resumedRunSamples.size(), 2);
+    for (size_t i=0; i<2; i++) {
+        EXPECT_EQ(resumedRunSamples[i].parameters, fullRunSamples[i+2].parameters);
+        expectSameHypergraphs(*resumedRunSamples[i].hypergraph, *fullRunSamples[i+2].hypergraph);
+    }
+    EXPECT_EQ(resumedRunOccurences, fullRunOccurences);
+
+    remove(checkpointFileName.c_str());
+}
+
+TEST(Checkpoint, resumeAndGetOccurences_defaultCanonicalization_chainContinuesIdentically) {
+    // Without a canonicalization interval, the state is only canonicalized before each checkpoint
+    generator.seed(42);
+    PHGPipeline fullRun(Hypergraph(8), {0.1, 0.2, 0.5, 5, 10});
+    fullRun.sampler.checkpointFileName = checkpointFileName;
+    fullRun.sampler.checkpointInterval = 3;
+    vector<ChainSample> fullRunSamples;
+    fullRun.sampler.sampleSink = recordSamplesIn(fullRunSamples);
+    auto fullRunOccurences = fullRun.sampler.sampleAndGetOccurences(4, 3);
+
+    // The last checkpoint was written after iteration 6, before the last sample
+    generator.seed(7);
+    PHGPipeline resumedRun(Hypergraph(8), {0.5, 0.5, 1, 1, 1});
+    resumedRun.sampler.checkpointFileName = checkpointFileName;
+    vector<ChainSample> resumedRunSamples;
+    resumedRun.sampler.sampleSink = recordSamplesIn(resumedRunSamples);
+    auto resumedRunOccurences = resumedRun.sampler.resumeAndGetOccurences(4, 3);
+
+    ASSERT_EQ(fullRunSamples.size(), 4);
+    ASSERT_EQ(resumedRunSamples.size(), 1);
+    EXPECT_EQ(resumedRunSamples[0].parameters, fullRunSamples[3].parameters);
+    expectSameHypergraphs(*resumedRunSamples[0].hypergraph, *fullRunSamples[3].hypergraph);
+    EXPECT_EQ(resumedRunOccurences, fullRunOccurences);
+
+    remove(checkpointFileName.c_str());
+}
+
+TEST(Checkpoint, resumeAndGetOccurences_otherChain_throwRuntimeError) {
+    generator.seed(42);
+    CheckpointedPHGPipeline run(Hypergraph(8), {0.1, 0.2, 0.5, 5, 10});
+    run.sampler.checkpointInterval = 2;
+    run.sampler.sampleAndGetOccurences(4, 0);
+
+    CheckpointedPHGPipeline otherChain(Hypergraph(8), {0.1, 0.2, 0.5, 5, 10});
+    otherChain.sampler.chainID = 3;
+    EXPECT_THROW(otherChain.sampler.resumeAndGetOccurences(4, 0), runtime_error);
+    EXPECT_THROW(run.sampler.resumeAndGetOccurences(3, 0), runtime_error);
+
+    remove(checkpointFileName.c_str());
+}
+
+TEST(Checkpoint, resumeAndGetOccurences_inexistentCheckpoint_throwRuntimeError) {
+    CheckpointedPHGPipeline run(Hypergraph(8), {0.1, 0.2, 0.5, 5, 10});
+    run.sampler.checkpointFileName = "inexistent_checkpoint.bin";
+    EXPECT_THROW(run.sampler.resumeAndGetOccurences(2, 0), runtime_error);
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <sstream>
+
+#include "GRIT/convergence_diagnostics.h"
+
+
+using namespace std;
+using namespace GRIT;
+
+
+static mt19937 testGenerator(42);
+
+static StreamingBatchMeans getAutoregressiveSeries(size_t sampleSize, double correlation, double mean=0) {
+    normal_distribution<double> noise(0, 1);
+    StreamingBatchMeans series;
+    double value = 0;
+    for (size_t i=0; i<sampleSize; i++) {
+        value = correlation*value + noise(testGenerator);
+        series.push(mean+value);
+    }
+    return series;
+}
+
+
+TEST(Moments, when_batchesMerged_expect_sameMomentsAsAllValues) {
+    Moments all, first, second;
+    for (size_t i=0; i<10; i++) {
+        double value = 1e6 + i*i;
+        all.add(value);
+        (i < 4 ? first : second).add(value);
+    }
+    first.merge(second);
+
+    EXPECT_EQ(first.count, all.count);
+    EXPECT_NEAR(first.mean, all.mean, 1e-9);
+    EXPECT_NEAR(first.getVariance(), all.getVariance(), 1e-6);
+}
+
+TEST(StreamingBatchMeans, when_fewSamples_expect_undefinedDiagnostics) {
+    auto series = getAutoregressiveSeries(StreamingBatchMeans::BATCH_NUMBER-1, 0);
+
+    EXPECT_FALSE(series.hasEnoughSamples());
+    EXPECT_TRUE(isnan(series.getEffectiveSampleSize()));
+    EXPECT_TRUE(isnan(series.getGewekeZScore()));
+}
+
+TEST(StreamingBatchMeans, when_manySamples_expect_boundedBatchNumber) {
+    auto series = getAutoregressiveSeries(100000, 0);
+
+    EXPECT_LT(series.getSampleNumber()/series.getBatchSize(), StreamingBatchMeans::BATCH_NUMBER);
+    EXPECT_GT(series.getSampleNumber(), 100000-2*series.getBatchSize());
+}
+
+TEST(StreamingBatchMeans, when_independentSamples_expect_effectiveSampleSizeCloseToSampleSize) {
+    auto series = getAutoregressiveSeries(100000, 0);
+    double sampleNumber = series.getSampleNumber();
+
+    EXPECT_GT(series.getEffectiveSampleSize(), 0.5*sampleNumber);
+    EXPECT_LT(series.getEffectiveSampleSize(), 2*sampleNumber);
+    EXPECT_LT(fabs(series.getGewekeZScore()), 4);
+}
+
+TEST(StreamingBatchMeans, when_autocorrelatedSamples_expect_effectiveSampleSizeOfAR1) {
+    double correlation = 0.9;
+    auto series = getAutoregressiveSeries(200000, correlation);
+    double expectedEffectiveSampleSize = series.getSampleNumber()*(1-correlation)/(1+correlation);
+
+    EXPECT_GT(series.getEffectiveSampleSize(), 0.5*expectedEffectiveSampleSize);
+    EXPECT_LT(series.getEffectiveSampleSize(), 2*expectedEffectiveSampleSize);
+}
+
+TEST(StreamingBatchMeans, when_seriesHasTrend_expect_largeGewekeZScore) {
+    StreamingBatchMeans series;
+    normal_distribution<double> noise(0, 1);
+    for (size_t i=0; i<10000; i++)
+        series.push(i*1e-3 + noise(testGenerator));
+
+    EXPECT_LT(series.getGewekeZScore(), -10);
+}
+
+TEST(StreamingBatchMeans, when_constantSeries_expect_sampleSizeAndNullZScore) {
+    StreamingBatchMeans series;
+    for (size_t i=0; i<1000; i++)
+        series.push(3);
+
+    EXPECT_EQ(series.getEffectiveSampleSize(), series.getSampleNumber());
+    EXPECT_EQ(series.getGewekeZScore(), 0);
+    EXPECT_EQ(getSplitRHat({&series}), 1);
+}
+
+TEST(SplitRHat, when_chainsHaveSameDistribution_expect_closeToOne) {
+    vector<StreamingBatchMeans> chains;
+    for (size_t i=0; i<4; i++)
+        chains.push_back(getAutoregressiveSeries(20000, 0.5));
+
+    double rHat = getSplitRHat({&chains[0], &chains[1], &chains[2], &chains[3]});
+    EXPECT_GE(rHat, 0.99);
+    EXPECT_LT(rHat, 1.01);
+}
+
+TEST(SplitRHat, when_chainsHaveDifferentMeans_expect_largerThanOne) {
+    auto chain1 = getAutoregressiveSeries(20000, 0.5, 0);
+    auto chain2 = getAutoregressiveSeries(20000, 0.5, 3);
+
+    EXPECT_GT(getSplitRHat({&chain1, &chain2}), 1.5);
+}
+
+TEST(ConvergenceMonitor, when_noTargets_expect_neverConverged) {
+    ConvergenceMonitor monitor;
+    Hypergraph hypergraph(3);
+    for (size_t i=0; i<1000; i++)
+        monitor.record(0, 0, hypergraph, {1, 2});
+
+    EXPECT_FALSE(monitor.hasConverged(0));
+    auto diagnostics = monitor.getDiagnostics(0);
+    ASSERT_EQ(diagnostics.size(), 5);
+    EXPECT_EQ(diagnostics[0].name, "log-likelihood");
+    EXPECT_EQ(diagnostics[4].name, "parameter 1");
+    EXPECT_EQ(diagnostics[4].mean, 2);
+}
+
+TEST(ConvergenceMonitor, when_chainDiffersFromOthers_expect_notConverged) {
+    ConvergenceMonitor monitor({0, 0, 1.1});
+    Hypergraph hypergraph(3);
+    normal_distribution<double> noise(0, 1);
+    for (size_t i=0; i<1000; i++) {
+        monitor.record(0, noise(testGenerator), hypergraph, {});
+        monitor.record(1, noise(testGenerator), hypergraph, {});
+    }
+    EXPECT_TRUE(monitor.hasConverged(0));
+
+    for (size_t i=0; i<1000; i++)
+        monitor.record(2, 5+noise(testGenerator), hypergraph, {});
+    EXPECT_FALSE(monitor.hasConverged(2));
+    EXPECT_FALSE(monitor.hasConverged(0));
+
+    monitor.resetChain(2);
+    EXPECT_TRUE(monitor.hasConverged(0));
+    EXPECT_TRUE(monitor.getDiagnostics(2).empty());
+}
+
+TEST(ConvergenceMonitor, when_chainStateWrittenAndRead_expect_sameDiagnostics) {
+    ConvergenceMonitor monitor, restoredMonitor;
+    Hypergraph hypergraph(3);
+    normal_distribution<double> noise(0, 1);
+    for (size_t i=0; i<1000; i++)
+        monitor.record(1, noise(testGenerator), hypergraph, {noise(testGenerator)});
+
+    stringstream state;
+    monitor.writeChainState(1, state);
+    restoredMonitor.readChainState(1, state);
+
+    auto diagnostics = monitor.getDiagnostics(1), restoredDiagnostics = restoredMonitor.getDiagnostics(1);
+    ASSERT_EQ(restoredDiagnostics.size(), diagnostics.size());
+    for (size_t i=0; i<diagnostics.size(); i++) {
+        EXPECT_EQ(restoredDiagnostics[i].sampleSize, diagnostics[i].sampleSize);
+        EXPECT_EQ(restoredDiagnostics[i].mean, diagnostics[i].mean);
+        EXPECT_EQ(restoredDiagnostics[i].effectiveSampleSize, diagnostics[i].effectiveSampleSize);
+    }
+
+    stringstream emptyState;
+    monitor.writeChainState(2, emptyState);
+    restoredMonitor.readChainState(1, emptyState);
+    EXPECT_TRUE(restoredMonitor.getDiagnostics(1).empty());
+}
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <cmath>
+#include <boost/math/special_functions/gamma.hpp>
+
+#include "GRIT/utility.h"
+
+
+using namespace std;
+using namespace GRIT;
+
+
+// (inf, sup, k, theta)
+static const vector<array<double, 4>> truncatedGammaCases {{
+    {MEAN_MIN, 1,        1000, 1./5000},
+    {0.2,      MEAN_MAX, 5000, 1./1000},
+    {0.2,      MEAN_MAX, 12,   1./2},
+    {3,        MEAN_MAX, 1.5,  2},
+    {0.01,     1,        0.5,  1},
+    {MEAN_MIN, MEAN_MAX, 0.2,  3},
+    {30,       40,       2,    1},
+    {0.1,      0.2,      50,   1},
+    {2,        2.5,      1,    1}
+}};
+
+// Mean of the truncated gamma, using the regularized gamma function that is the most precise for the bounds
+static double getTruncatedGammaMean(double inf, double sup, double k, double theta) {
+    double a = inf/theta, b = sup/theta;
+    if (a > k)
+        return k*theta*(boost::math::gamma_q(k+1, a)-boost::math::gamma_q(k+1, b))/(boost::math::gamma_q(k, a)-boost::math::gamma_q(k, b));
+    return k*theta*(boost::math::gamma_p(k+1, b)-boost::math::gamma_p(k+1, a))/(boost::math::gamma_p(k, b)-boost::math::gamma_p(k, a));
+}
+
+
+TEST(TruncatedGamma, envelopeRS_when_drawingFromTruncations_expect_samplesInBoundsWithExactMean) {
+    generator.seed(42);
+    const size_t sampleSize = 20000;
+
+    for (auto& parameters: truncatedGammaCases) {
+        const double& inf = parameters[0], sup = parameters[1], k = parameters[2], theta = parameters[3];
+
+        double mean = 0, squaresMean = 0;
+        for (size_t i=0; i<sampleSize; i++) {
+            double sample = drawTruncatedGammaWithEnvelopeRS(inf, sup, k, theta);
+            ASSERT_GE(sample, inf);
+            ASSERT_LE(sample, sup);
+            mean += sample/sampleSize;
+            squaresMean += sample*sample/sampleSize;
+        }
+        double standardError = sqrt((squaresMean-mean*mean)/sampleSize);
+        EXPECT_NEAR(mean, getTruncatedGammaMean(inf, sup, k, theta), 5*standardError)
+            << "Truncated gamma on [" << inf << ", " << sup << "] with k=" << k << " and theta=" << theta;
+    }
+}
+
+TEST(TruncatedGamma, envelopeRS_when_invalidBounds_expect_logicError) {
+    EXPECT_THROW(drawTruncatedGammaWithEnvelopeRS(2, 1, 2, 1), logic_error);
+    EXPECT_THROW(drawTruncatedGammaWithEnvelopeRS(1, 2, 0, 1), logic_error);
+}
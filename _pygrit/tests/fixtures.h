@@ -0,0 +1,78 @@
+#ifndef GRIT_TEST_FIXTURES_H
+#define GRIT_TEST_FIXTURES_H
+
+#include <array>
+#include <vector>
+
+#include "GRIT/utility.h"
+#include "GRIT/hypergraph.h"
+#include "GRIT/gibbs_sampler.hpp"
+#include "GRIT/metropolis-hastings.hpp"
+
+#include "GRIT/parameters-samplers/poisson_independent_hyperedges.h"
+#include "GRIT/observations-models/poisson_hypergraph.h"
+#include "GRIT/hypergraph-models/independent_hyperedges.h"
+#include "GRIT/priors/poisson_independent_hyperedges.h"
+
+#include "GRIT/proposers/sixsteps_hypergraph.h"
+#include "GRIT/proposers/edge-choosers/uniform_edge_chooser.h"
+#include "GRIT/proposers/edge-choosers/weighted_unique_chooser.h"
+#include "GRIT/proposers/triangle-choosers/observations_by_pairs_chooser.h"
+#include "GRIT/proposers/triangle-choosers/uniform_triangle_chooser.h"
+
+
+typedef GRIT::MetropolisHastings<GRIT::HypergraphSixStepsProposer, GRIT::PoissonHypergraphObservationsModel,
+                                 GRIT::IndependentHyperedgesModel, GRIT::PoissonHypergraph_BetaAndGammaPriors> HypergraphSampler;
+typedef GRIT::GibbsSampler<GRIT::PoissonIndependentHyperedgesParameterSampler, HypergraphSampler> ModelSampler;
+
+
+inline GRIT::Parameters getTestHyperparameters() {
+    return {1.1, 5, 1.1, 5, 1.0001, 0.5, 4, 0.2, 4, 0.2};
+}
+
+// Two dense groups {0, 1, 2} and {3, 4, 5} loosely tied to vertices 6 and 7
+inline GRIT::Observations getTestObservations() {
+    return {
+        {0, 9, 8, 0, 1, 0, 0, 2},
+        {9, 0, 7, 3, 0, 0, 1, 0},
+        {8, 7, 0, 0, 0, 2, 0, 0},
+        {0, 3, 0, 0, 12, 11, 0, 1},
+        {1, 0, 0, 12, 0, 10, 0, 0},
+        {0, 0, 2, 11, 10, 0, 4, 0},
+        {0, 1, 0, 0, 0, 4, 0, 5},
+        {2, 0, 0, 1, 0, 0, 5, 0}
+    };
+}
+
+// Same assembly as the PHG inference model
+struct PHGPipeline {
+    GRIT::Hypergraph hypergraph;
+    GRIT::Parameters parameters, hyperparameters;
+    GRIT::Observations observations;
+
+    GRIT::ObservationsWeightedUniqueEdgeChooser edgeAdder;
+    GRIT::UniformNonEdgeChooser edgeRemover;
+    GRIT::ObservationsPairwiseTriangleChooser triangleAdder;
+    GRIT::UniformTriangleChooser triangleRemover;
+
+    GRIT::HypergraphSixStepsProposer proposer;
+    HypergraphSampler hypergraphSampler;
+    GRIT::PoissonIndependentHyperedgesParameterSampler parameterSampler;
+    ModelSampler sampler;
+
+    PHGPipeline(const GRIT::Hypergraph& initialHypergraph, const GRIT::Parameters& initialParameters,
+                const std::vector<double>& moveProbabilities={0.45, 0.45, 0.1}):
+        hypergraph(initialHypergraph), parameters(initialParameters), hyperparameters(getTestHyperparameters()),
+        observations(getTestObservations()),
+        edgeAdder(observations, hypergraph), edgeRemover(hypergraph), triangleAdder(observations), triangleRemover(hypergraph),
+        proposer(hypergraph, parameters, hyperparameters, observations,
+                 triangleAdder, triangleRemover, edgeAdder, edgeRemover, moveProbabilities),
+        hypergraphSampler(hypergraph, observations, parameters, hyperparameters, proposer, {10, 200}, 50, 1e-3),
+        parameterSampler(hypergraph, observations, parameters, hyperparameters),
+        sampler(hypergraph, parameters, parameterSampler, hypergraphSampler)
+    {
+        sampler.setVerbose(0);
+    }
+};
+
+#endif
@@ -9,9 +9,12 @@ class GibbsTesting: public GRIT::GibbsBase {
     public:
         explicit GibbsTesting(GRIT::Hypergraph& hypergraph, GRIT::Parameters& parameters, size_t verbose=2): GRIT::GibbsBase(hypergraph, parameters, verbose) {};
 
-        void sampleFromPosterior() {}
+        size_t iterations = 0;
+
+        void sampleFromPosterior() { iterations++; }
         void sampleHypergraphChain(size_t mhSteps, size_t points, const std::list<size_t>& iterations) {}
         double getAverageLogLikelihood() {return 0;}
+        double getCurrentLogLikelihood() const {return 0;}
         void resetValues() {}
 };
 
@@ -92,3 +95,56 @@ TEST(updateMostCommonTypes, hypergraph_correctUpdate) {
         for (size_t j=i+1; j<n; j++)
             EXPECT_EQ(averageHypergraph.getEdgeMultiplicity(i, j), averageHypergraphTypes[i][j]);
 }
+
+TEST(sampleSink, sinkRequestsStop_chainStoppedAfterSample) {
+    GRIT::Hypergraph hypergraph(3);
+    GRIT::Parameters p = {1.5};
+    GibbsTesting gibbsTester(hypergraph, p, 0);
+    gibbsTester.chainID = 2;
+
+    std::vector<GRIT::ChainSample> samples;
+    gibbsTester.sampleSink = [&](const GRIT::ChainSample& sample) {
+        samples.push_back(sample);
+        return sample.iteration == 3;
+    };
+    gibbsTester.sampleAndGetOccurences(10, 2);
+
+    EXPECT_EQ(gibbsTester.iterations, 6);
+    ASSERT_EQ(samples.size(), 4);
+    for (size_t i=0; i<4; i++) {
+        EXPECT_EQ(samples[i].chain, 2);
+        EXPECT_EQ(samples[i].iteration, i);
+        EXPECT_EQ(samples[i].parameters, GRIT::Parameters({1.5}));
+    }
+}
+
+TEST(sampleSink, hypergraphChangedAfterSample_sampleUnchanged) {
+    GRIT::Hypergraph hypergraph(3);
+    GRIT::Parameters p;
+    GibbsTesting gibbsTester(hypergraph, p, 0);
+
+    std::vector<GRIT::ChainSample> samples;
+    gibbsTester.sampleSink = [&](const GRIT::ChainSample& sample) {
+        samples.push_back(sample);
+        return false;
+    };
+    gibbsTester.sampleAndGetOccurences(1, 0);
+    hypergraph.addEdge(0, 1);
+
+    ASSERT_EQ(samples.size(), 1);
+    EXPECT_EQ(samples[0].hypergraph->getEdgeNumber(), 0);
+}
+
+TEST(convergenceMonitor, targetsMet_chainStoppedBeforeSampleSize) {
+    GRIT::Hypergraph hypergraph(3);
+    GRIT::Parameters p = {1.5};
+    GibbsTesting gibbsTester(hypergraph, p, 0);
+    gibbsTester.convergenceMonitor = std::make_shared<GRIT::ConvergenceMonitor>(GRIT::ConvergenceTargets{100, 0, 0});
+
+    gibbsTester.sampleAndGetOccurences(1000, 10);
+
+    EXPECT_GE(gibbsTester.iterations, 110);
+    EXPECT_LT(gibbsTester.iterations, 300);
+    EXPECT_TRUE(gibbsTester.convergenceMonitor->hasConverged(gibbsTester.chainID));
+    EXPECT_EQ(gibbsTester.getOccurencesSampleNumber(), gibbsTester.iterations-10);
+}
@@ -222,6 +222,34 @@ TEST(Hypergraph, getHighestOrderHyperedgeWith_edgeCoveredByTriangle_return2) {
 }
 
 
+TEST(Hypergraph, getTripletPairsHighestOrder_everyTriplet_sameAsPairwiseQueries) {
+    Hypergraph hypergraph(7);
+    hypergraph.addTriangle({0, 2, 4});
+    hypergraph.addTriangle({1, 2, 4});
+    hypergraph.addTriangle({0, 3, 5});
+    hypergraph.addTriangle({2, 5, 6});
+    hypergraph.addTriangle({3, 4, 6});
+    hypergraph.addEdge(0, 1);
+    hypergraph.addEdge(2, 6);
+    hypergraph.addMultiedge(4, 5, 2);
+    hypergraph.addEdge(1, 3);
+
+    for (size_t i=0; i<7; i++)
+        for (size_t j=i+1; j<7; j++)
+            for (size_t k=j+1; k<7; k++) {
+                Triplet triplet {i, j, k};
+                auto highestOrders = hypergraph.getTripletPairsHighestOrder(triplet, false);
+                EXPECT_EQ(highestOrders[0], hypergraph.getHighestOrderHyperedgeWith(i, j));
+                EXPECT_EQ(highestOrders[1], hypergraph.getHighestOrderHyperedgeWith(i, k));
+                EXPECT_EQ(highestOrders[2], hypergraph.getHighestOrderHyperedgeWith(j, k));
+
+                highestOrders = hypergraph.getTripletPairsHighestOrder(triplet, true);
+                EXPECT_EQ(highestOrders[0], hypergraph.getHighestOrderHyperedgeExcluding(i, j, triplet));
+                EXPECT_EQ(highestOrders[1], hypergraph.getHighestOrderHyperedgeExcluding(i, k, triplet));
+                EXPECT_EQ(highestOrders[2], hypergraph.getHighestOrderHyperedgeExcluding(j, k, triplet));
+            }
+}
+
 TEST(Hypergraph, writeToBinary_multiedges_correctMultiplicites) {
     Hypergraph hypergraph(5);
     EXPECT_TRUE(hypergraph.addMultiedge(0, 2, 1));
@@ -300,3 +328,91 @@ TEST(Hypergraph, writeToBinary_trianglesAndEdges_correctAdjacencies) {
     EXPECT_EQ(loadedHypergraph.getTriangleNumber(), 4);
     remove("tmp_test.bin_triangles");
 }
+
+static Hypergraph getHypergraphForCompactFormat() {
+    Hypergraph hypergraph(10);
+    hypergraph.addMultiedge(0, 2, 3);
+    hypergraph.addMultiedge(1, 0, 4);
+    hypergraph.addEdge(9, 3);
+
+    hypergraph.addTriangle({1, 3, 2});
+    hypergraph.addTriangle({6, 1, 2});
+    hypergraph.addTriangle({1, 8, 9});
+    hypergraph.addTriangle({7, 8, 9});
+    return hypergraph;
+}
+
+static void expectCompactHypergraphLoaded(const Hypergraph& loadedHypergraph) {
+    EXPECT_EQ(loadedHypergraph.getSize(), 10);
+    EXPECT_EQ(loadedHypergraph.getEdgesFrom(0), AdjacentEdges({ {1, 4}, {2, 3} }));
+    EXPECT_EQ(loadedHypergraph.getEdgesFrom(1), AdjacentEdges({ {0, 4} }));
+    EXPECT_EQ(loadedHypergraph.getEdgesFrom(2), AdjacentEdges({ {0, 3} }));
+    EXPECT_EQ(loadedHypergraph.getEdgesFrom(3), AdjacentEdges({ {9, 1} }));
+    EXPECT_EQ(loadedHypergraph.getEdgesFrom(9), AdjacentEdges({ {3, 1} }));
+    EXPECT_EQ(loadedHypergraph.getEdgeNumber(), 3);
+
+    EXPECT_EQ(loadedHypergraph.getTrianglesFrom(0), AdjacentTriangles{} );
+    EXPECT_EQ(loadedHypergraph.getTrianglesFrom(1), AdjacentTriangles({ {2, {3, 6}}, {8, {9}} }));
+    EXPECT_EQ(loadedHypergraph.getTrianglesFrom(2), AdjacentTriangles({ {1, {3, 6}} }));
+    EXPECT_EQ(loadedHypergraph.getTrianglesFrom(3), AdjacentTriangles({ {1, {2}} }));
+    EXPECT_EQ(loadedHypergraph.getTrianglesFrom(6), AdjacentTriangles({ {1, {2}} }));
+    EXPECT_EQ(loadedHypergraph.getTrianglesFrom(8), AdjacentTriangles({ {7, {9}}, {1, {9}} }));
+    EXPECT_EQ(loadedHypergraph.getTrianglesFrom(9), AdjacentTriangles({ {7, {8}}, {1, {8}} }));
+    EXPECT_EQ(loadedHypergraph.getTriangleNumber(), 4);
+}
+
+TEST(Hypergraph, writeToCompactBinary_uncompressed_correctAdjacencies) {
+    getHypergraphForCompactFormat().writeToCompactBinary("tmp_test.bin");
+    expectCompactHypergraphLoaded(Hypergraph::loadFromCompactBinary("tmp_test.bin"));
+    remove("tmp_test.bin");
+}
+
+TEST(Hypergraph, writeToCompactBinary_compressed_correctAdjacencies) {
+    getHypergraphForCompactFormat().writeToCompactBinary("tmp_test.bin", true);
+    expectCompactHypergraphLoaded(Hypergraph::loadFromCompactBinary("tmp_test.bin"));
+    remove("tmp_test.bin");
+}
+
+TEST(Hypergraph, loadFromBinary_compactFile_formatDetected) {
+    getHypergraphForCompactFormat().writeToCompactBinary("tmp_test.bin", true);
+    expectCompactHypergraphLoaded(Hypergraph::loadFromBinary("tmp_test.bin"));
+    remove("tmp_test.bin");
+}
+
+TEST(Hypergraph, loadFromCompactBinary_corruptedFile_throwRuntimeError) {
+    getHypergraphForCompactFormat().writeToCompactBinary("tmp_test.bin");
+    {
+        fstream fileStream("tmp_test.bin", ios::in|ios::out|ios::binary);
+        fileStream.seekp(-1, ios::end);
+        fileStream.put(100);
+    }
+    EXPECT_THROW(Hypergraph::loadFromCompactBinary("tmp_test.bin"), runtime_error);
+    remove("tmp_test.bin");
+}
+
+TEST(Hypergraph, addSortedEdges_unsortedEdges_throwLogicError) {
+    Hypergraph hypergraph(4);
+    size_t edges[6] = {1, 2, 1, 0, 3, 1};
+    EXPECT_THROW(hypergraph.addSortedEdges(edges, 2), logic_error);
+}
+
+TEST(Hypergraph, addSortedTriangles_unorderedTriplet_throwLogicError) {
+    Hypergraph hypergraph(4);
+    size_t triangles[3] = {0, 3, 2};
+    EXPECT_THROW(hypergraph.addSortedTriangles(triangles, 1), logic_error);
+}
+
+TEST(Hypergraph, getHigherNeighbourTypes_edgesAndTriangles_sortedTypesOfHigherPairs) {
+    Hypergraph hypergraph(6);
+    hypergraph.addMultiedge(2, 5, 3);
+    hypergraph.addEdge(2, 0);
+    hypergraph.addEdge(2, 3);
+    hypergraph.addTriangle({1, 2, 3});
+    hypergraph.addTriangle({2, 4, 0});
+
+    vector<pair<Index, size_t>> multiplicities {{3, 1}, {5, 3}};
+    vector<pair<Index, size_t>> highestOrders {{3, 2}, {4, 2}, {5, 1}};
+    EXPECT_EQ(hypergraph.getHigherNeighbourTypes(2, false), multiplicities);
+    EXPECT_EQ(hypergraph.getHigherNeighbourTypes(2, true), highestOrders);
+    EXPECT_TRUE(hypergraph.getHigherNeighbourTypes(5, true).empty());
+}
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include "GRIT/utility.h"
+#include "GRIT/hypergraph.h"
+#include "GRIT/hypergraph_generation.h"
+
+
+using namespace std;
+using namespace GRIT;
+
+
+static vector<array<size_t, 3>> getSortedEdges(const Hypergraph& hypergraph) {
+    vector<array<size_t, 3>> edges;
+    for (size_t i=0; i<hypergraph.getSize(); i++)
+        for (auto& neighbour: hypergraph.getEdgesFrom(i))
+            if (i < neighbour.first)
+                edges.push_back({i, neighbour.first, neighbour.second});
+    sort(edges.begin(), edges.end());
+    return edges;
+}
+
+static vector<array<size_t, 3>> getSortedTriangles(const Hypergraph& hypergraph) {
+    vector<array<size_t, 3>> triangles;
+    for (auto& triplet: hypergraph.getFullTriangleList()) {
+        auto ordered = triplet.getOrdered();
+        triangles.push_back({ordered.i, ordered.j, ordered.k});
+    }
+    sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+static void expectSameHypergraphs(const Hypergraph& hypergraph1, const Hypergraph& hypergraph2) {
+    ASSERT_EQ(hypergraph1.getSize(), hypergraph2.getSize());
+    EXPECT_EQ(getSortedEdges(hypergraph1), getSortedEdges(hypergraph2));
+    EXPECT_EQ(getSortedTriangles(hypergraph1), getSortedTriangles(hypergraph2));
+}
+
+// Observed number of successes among "trials" Bernoulli draws is within 5 standard deviations
+static void expectBinomialCount(double count, double trials, double probability) {
+    EXPECT_NEAR(count, trials*probability, 5*sqrt(trials*probability*(1-probability))+1);
+}
+
+
+TEST(IndependentTriangleHypergraph, when_triangleProbability_expect_binomialTriangleNumber) {
+    generator.seed(4);
+    auto hypergraph = generateIndependentTriangleHypergraph(60, 0.05);
+
+    EXPECT_EQ(getSortedEdges(hypergraph).size(), 0);
+    expectBinomialCount(getSortedTriangles(hypergraph).size(), nchoose3(60), 0.05);
+}
+
+TEST(IndependentTriangleHypergraph, when_probabilityOne_expect_everyTriangle) {
+    EXPECT_EQ(getSortedTriangles(generateIndependentTriangleHypergraph(10, 1)).size(), nchoose3(10));
+}
+
+// Propensities spread over [low, high] in a shuffled vertex order
+static vector<double> getSpreadPropensities(size_t n, double low, double high) {
+    vector<double> propensities(n);
+    for (size_t i=0; i<n; i++)
+        propensities[i] = low + (high-low)*((7*i)%n)/(n-1);
+    return propensities;
+}
+
+static void countHyperedges(const Hypergraph& hypergraph, map<array<size_t, 3>, double>& edgeCounts, map<array<size_t, 3>, double>& triangleCounts) {
+    for (auto& edge: getSortedEdges(hypergraph)) {
+        EXPECT_EQ(edge[2], 1);
+        edgeCounts[{edge[0], edge[1], 0}]++;
+    }
+    for (auto& triangle: getSortedTriangles(hypergraph))
+        triangleCounts[triangle]++;
+}
+
+// Frequencies of both generators agree within 5 standard deviations of their difference
+static void expectSameFrequencies(const map<array<size_t, 3>, double>& counts1, const map<array<size_t, 3>, double>& counts2,
+                                  const vector<array<size_t, 3>>& hyperedges, double replicates) {
+    for (auto& hyperedge: hyperedges) {
+        auto it1 = counts1.find(hyperedge), it2 = counts2.find(hyperedge);
+        double frequency1 = it1 == counts1.end() ? 0 : it1->second/replicates;
+        double frequency2 = it2 == counts2.end() ? 0 : it2->second/replicates;
+        double p = (frequency1+frequency2)/2;
+        EXPECT_NEAR(frequency1, frequency2, 5*sqrt(2*p*(1-p)/replicates)+2/replicates)
+            << "hyperedge {" << hyperedge[0] << ", " << hyperedge[1] << ", " << hyperedge[2] << "}";
+    }
+}
+
+TEST(BetaModelHypergraph, when_skipping_expect_sameHyperedgeFrequenciesAsReferenceGenerator) {
+    const size_t n = 30, replicates = 400;
+    auto edgePropensities = getSpreadPropensities(n, -3, 1);
+    auto trianglePropensities = getSpreadPropensities(n, -4, 0);
+
+    map<array<size_t, 3>, double> referenceEdges, referenceTriangles, skippingEdges, skippingTriangles;
+    for (size_t replicate=0; replicate<replicates; replicate++) {
+        generator.seed(replicate);
+        countHyperedges(generateBetaModelHypergraph(edgePropensities, trianglePropensities), referenceEdges, referenceTriangles);
+        generator.seed(replicates+replicate);
+        countHyperedges(generateBetaModelHypergraphBySkipping(edgePropensities, trianglePropensities, 2), skippingEdges, skippingTriangles);
+    }
+
+    vector<array<size_t, 3>> pairs, triplets;
+    for (size_t i=0; i<n; i++)
+        for (size_t j=i+1; j<n; j++) {
+            pairs.push_back({i, j, 0});
+            for (size_t k=j+1; k<n; k++)
+                triplets.push_back({i, j, k});
+        }
+    expectSameFrequencies(referenceEdges, skippingEdges, pairs, replicates);
+    expectSameFrequencies(referenceTriangles, skippingTriangles, triplets, replicates);
+}
+
+TEST(BetaModelHypergraph, when_sameGlobalSeed_expect_sameSkippingHypergraphForAnyThreadNumber) {
+    generator.seed(3);
+    auto hypergraph = generateBetaModelHypergraphBySkipping(300, -2, 1, -3, 1, 1);
+    ASSERT_GT(getSortedEdges(hypergraph).size(), 0);
+    ASSERT_GT(getSortedTriangles(hypergraph).size(), 0);
+
+    generator.seed(3);
+    expectSameHypergraphs(generateBetaModelHypergraphBySkipping(300, -2, 1, -3, 1, 4), hypergraph);
+}
+
+TEST(BetaModelHypergraph, when_propensitySizesDiffer_expect_logicError) {
+    EXPECT_THROW(generateBetaModelHypergraph({0, 0, 0}, {0, 0}), logic_error);
+    EXPECT_THROW(generateBetaModelHypergraphBySkipping({0, 0, 0}, {0, 0}), logic_error);
+}
+
+static const vector<double> communitySizes {60, 80, 40};
+static size_t getCommunity(size_t vertex) {
+    return vertex < 60 ? 0 : vertex < 140 ? 1 : 2;
+}
+
+TEST(SBMHypergraph, when_sameGlobalSeed_expect_sameHypergraphForAnyThreadNumber) {
+    generator.seed(5);
+    auto hypergraph = generateSBMHypergraph(communitySizes, {0.3, 0.1, 0.5}, 0.02, {0.05, 0.01, 0.1}, 0.001, 1);
+    generator.seed(5);
+    expectSameHypergraphs(generateSBMHypergraph(communitySizes, {0.3, 0.1, 0.5}, 0.02, {0.05, 0.01, 0.1}, 0.001, 4), hypergraph);
+
+    generator.seed(6);
+    auto otherHypergraph = generateSBMHypergraph(communitySizes, {0.3, 0.1, 0.5}, 0.02, {0.05, 0.01, 0.1}, 0.001, 4);
+    EXPECT_NE(getSortedEdges(otherHypergraph), getSortedEdges(hypergraph));
+}
+
+TEST(SBMHypergraph, when_intraAndInterCommunityProbabilities_expect_blockDensities) {
+    const vector<double> edgeProbabilities {0.3, 0.1, 0.5}, triangleProbabilities {0.05, 0.01, 0.1};
+    const double interEdgeProbability = 0.02, interTriangleProbability = 0.001;
+
+    generator.seed(8);
+    auto hypergraph = generateSBMHypergraph(communitySizes, edgeProbabilities, interEdgeProbability,
+                                            triangleProbabilities, interTriangleProbability);
+    ASSERT_EQ(hypergraph.getSize(), 180);
+
+    double intraEdges[3] = {0, 0, 0}, interEdges = 0, intraTriangles[3] = {0, 0, 0}, interTriangles = 0;
+    for (auto& edge: getSortedEdges(hypergraph)) {
+        EXPECT_EQ(edge[2], 1);
+        if (getCommunity(edge[0]) == getCommunity(edge[1]))
+            intraEdges[getCommunity(edge[0])]++;
+        else
+            interEdges++;
+    }
+    for (auto& triangle: getSortedTriangles(hypergraph)) {
+        if (getCommunity(triangle[0]) == getCommunity(triangle[1]) && getCommunity(triangle[1]) == getCommunity(triangle[2]))
+            intraTriangles[getCommunity(triangle[0])]++;
+        else
+            interTriangles++;
+    }
+
+    double interPairs = nchoose2(180), interTriplets = nchoose3(180);
+    for (size_t community=0; community<3; community++) {
+        size_t size = communitySizes[community];
+        expectBinomialCount(intraEdges[community], nchoose2(size), edgeProbabilities[community]);
+        expectBinomialCount(intraTriangles[community], nchoose3(size), triangleProbabilities[community]);
+        interPairs -= nchoose2(size);
+        interTriplets -= nchoose3(size);
+    }
+    expectBinomialCount(interEdges, interPairs, interEdgeProbability);
+    expectBinomialCount(interTriangles, interTriplets, interTriangleProbability);
+}
+
+TEST(SBMHypergraph, when_nonIntegerCommunitySize_expect_logicError) {
+    EXPECT_THROW(generateSBMHypergraph({10, 2.5}, {0.1, 0.1}, 0, {0.1, 0.1}, 0), logic_error);
+    EXPECT_THROW(generateSBMHypergraph({10, 10}, {0.1}, 0, {0.1, 0.1}, 0), logic_error);
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "GRIT/utility.h"
+#include "GRIT/hypergraph.h"
+#include "GRIT/hypergraph_transformations.h"
+
+
+using namespace std;
+using namespace GRIT;
+
+
+static Hypergraph getHypergraph() {
+    Hypergraph hypergraph(8);
+    hypergraph.addMultiedge(6, 1, 2);
+    hypergraph.addEdge(3, 1);
+    hypergraph.addEdge(6, 3);
+    hypergraph.addTriangle({3, 6, 4});
+    hypergraph.addTriangle({1, 4, 3});
+    return hypergraph;
+}
+
+
+TEST(removeDisconnectedVertices, when_isolatedVertices_expect_removedAndOrderKept) {
+    auto filtered = removeDisconnectedVertices(getHypergraph());
+
+    // Vertices 1, 3, 4 and 6 become 0, 1, 2 and 3
+    EXPECT_EQ(filtered.getSize(), 4);
+    EXPECT_EQ(filtered.getEdgeNumber(), 3);
+    EXPECT_EQ(filtered.getEdgeMultiplicity(0, 3), 2);
+    EXPECT_EQ(filtered.getEdgeMultiplicity(0, 1), 1);
+    EXPECT_EQ(filtered.getEdgeMultiplicity(1, 3), 1);
+    EXPECT_EQ(filtered.getTriangleNumber(), 2);
+    EXPECT_TRUE(filtered.isTriangle({1, 2, 3}));
+    EXPECT_TRUE(filtered.isTriangle({0, 1, 2}));
+}
+
+TEST(projectHypergraph, when_edgesAndTriangles_expect_pairsOfEveryHyperedge) {
+    auto hypergraph = getHypergraph();
+    auto graph = projectHypergraphOnGraph(hypergraph);
+    auto multigraph = projectHypergraphOnMultigraph(hypergraph);
+
+    EXPECT_EQ(graph.getTriangleNumber(), 0);
+    EXPECT_EQ(multigraph.getTriangleNumber(), 0);
+    for (Index i=0; i<hypergraph.getSize(); i++)
+        for (Index j=i+1; j<hypergraph.getSize(); j++) {
+            size_t highestOrder = hypergraph.getHighestOrderHyperedgeWith(i, j);
+            EXPECT_EQ(graph.getEdgeMultiplicity(i, j), highestOrder > 0 ? 1 : 0);
+            EXPECT_EQ(multigraph.getEdgeMultiplicity(i, j), highestOrder);
+        }
+    EXPECT_EQ(graph.getEdgeNumber(), 6);
+}
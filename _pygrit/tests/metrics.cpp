@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "GRIT/utility.h"
+#include "GRIT/hypergraph.h"
+#include "GRIT/metrics.h"
+
+
+using namespace std;
+using namespace GRIT;
+
+
+static size_t countEdgesInTrianglesByEnumeration(const vector<size_t>& edgeTypes, size_t n) {
+    set<pair<size_t, size_t>> edgesInTriangles;
+    for (size_t i=0; i<n; i++)
+        for (size_t j=i+1; j<n; j++)
+            for (size_t k=j+1; k<n; k++)
+                if (edgeTypes[i*n+j] > 0 && edgeTypes[i*n+k] > 0 && edgeTypes[j*n+k] > 0) {
+                    if (edgeTypes[i*n+j] == 1) edgesInTriangles.insert({i, j});
+                    if (edgeTypes[i*n+k] == 1) edgesInTriangles.insert({i, k});
+                    if (edgeTypes[j*n+k] == 1) edgesInTriangles.insert({j, k});
+                }
+    return edgesInTriangles.size();
+}
+
+
+TEST(countEdgesInTriangles, when_singleTriangleAndPendantEdge_expect_edgesOfTriangleCounted) {
+    const size_t n = 4;
+    vector<size_t> edgeTypes(n*n, 0);
+    edgeTypes[0*n+1] = 1;
+    edgeTypes[0*n+2] = 2;
+    edgeTypes[1*n+2] = 1;
+    edgeTypes[2*n+3] = 1;
+    // Lower triangle is ignored
+    edgeTypes[3*n+0] = 1;
+    edgeTypes[3*n+1] = 1;
+
+    EXPECT_EQ(countEdgesInTriangles(edgeTypes.data(), n), 2);
+}
+
+TEST(countEdgesInTriangles, when_randomEdgeTypes_expect_countOfEnumeration) {
+    mt19937 randomGenerator(4);
+    for (size_t n: {1, 2, 30, 90}) {
+        for (double density: {0.05, 0.3, 0.8}) {
+            vector<size_t> edgeTypes(n*n, 0);
+            for (auto& type: edgeTypes)
+                if (uniform_real_distribution<double>(0, 1)(randomGenerator) < density)
+                    type = uniform_int_distribution<size_t>(1, 3)(randomGenerator);
+
+            size_t expectedCount = countEdgesInTrianglesByEnumeration(edgeTypes, n);
+            EXPECT_EQ(countEdgesInTriangles(edgeTypes.data(), n, 1), expectedCount);
+            EXPECT_EQ(countEdgesInTriangles(edgeTypes.data(), n, 4), expectedCount);
+        }
+    }
+}
+
+TEST(getResidualsOfTypes, when_replicates_expect_sumsByTypeOfEachReplicate) {
+    mt19937 randomGenerator(2);
+    const size_t pairNumber = 200003, replicateNumber = 3;
+    vector<int8_t> edgeTypes(pairNumber);
+    vector<uint32_t> observations(pairNumber), replicates(replicateNumber*pairNumber);
+    for (auto& type: edgeTypes)
+        type = uniform_int_distribution<int>(0, 2)(randomGenerator);
+    for (auto& count: observations)
+        count = uniform_int_distribution<uint32_t>(0, 20)(randomGenerator);
+    for (auto& count: replicates)
+        count = uniform_int_distribution<uint32_t>(0, 20)(randomGenerator);
+
+    auto residuals = getResidualsOfTypes(edgeTypes.data(), observations.data(), replicates.data(), replicateNumber, pairNumber, 4);
+
+    ASSERT_EQ(residuals.size(), replicateNumber);
+    for (size_t replicate=0; replicate<replicateNumber; replicate++) {
+        double sums[3] = {0, 0, 0}, absoluteSums[3] = {0, 0, 0};
+        for (size_t pair=0; pair<pairNumber; pair++) {
+            double residual = (double) observations[pair] - (double) replicates[replicate*pairNumber+pair];
+            sums[edgeTypes[pair]] += residual;
+            absoluteSums[edgeTypes[pair]] += abs(residual);
+        }
+        for (size_t type=0; type<3; type++) {
+            EXPECT_EQ(residuals[replicate].sums[type], sums[type]);
+            EXPECT_EQ(residuals[replicate].absoluteSums[type], absoluteSums[type]);
+        }
+    }
+}
+
+TEST(getResidualsOfTypes, when_typeAbove2_expect_logicError) {
+    vector<int8_t> edgeTypes {0, 3};
+    vector<uint32_t> observations {1, 2};
+    EXPECT_THROW(getResidualsOfTypes(edgeTypes.data(), observations.data(), observations.data(), 1, 2), logic_error);
+}
+
+
+static Hypergraph getRandomHypergraph(size_t n, mt19937& generator) {
+    Hypergraph hypergraph(n);
+    uniform_int_distribution<size_t> vertexDistribution(0, n-1);
+    for (size_t edge=0; edge<2*n; edge++) {
+        size_t i = vertexDistribution(generator), j = vertexDistribution(generator);
+        if (i != j)
+            hypergraph.addEdge(i, j);
+    }
+    for (size_t triangle=0; triangle<n/2; triangle++) {
+        size_t i = vertexDistribution(generator), j = vertexDistribution(generator), k = vertexDistribution(generator);
+        if (i != j && j != k && i != k)
+            hypergraph.addTriangle({i, j, k});
+    }
+    return hypergraph;
+}
+
+static size_t getHammingDistanceByEnumeration(const Hypergraph& hypergraph1, const Hypergraph& hypergraph2, bool global) {
+    size_t distance = 0;
+    for (size_t i=0; i<hypergraph1.getSize(); i++)
+        for (size_t j=i+1; j<hypergraph1.getSize(); j++)
+            if (global)
+                distance += hypergraph1.getHighestOrderHyperedgeWith(i, j) != hypergraph2.getHighestOrderHyperedgeWith(i, j);
+            else
+                distance += hypergraph1.getEdgeMultiplicity(i, j) != hypergraph2.getEdgeMultiplicity(i, j);
+    return distance;
+}
+
+
+TEST(getHammingDistance, when_randomHypergraphs_expect_distanceOfEnumeration) {
+    mt19937 generator(7);
+    for (size_t trial=0; trial<20; trial++) {
+        auto hypergraph1 = getRandomHypergraph(25, generator);
+        auto hypergraph2 = getRandomHypergraph(25, generator);
+        EXPECT_EQ(getEdgeHammingDistance(hypergraph1, hypergraph2), getHammingDistanceByEnumeration(hypergraph1, hypergraph2, false));
+        EXPECT_EQ(getGlobalHammingDistance(hypergraph1, hypergraph2), getHammingDistanceByEnumeration(hypergraph1, hypergraph2, true));
+        EXPECT_EQ(getGlobalHammingDistance(hypergraph1, hypergraph1), 0);
+    }
+}
+
+TEST(getHammingDistance, when_differentSizes_expect_logicError) {
+    EXPECT_THROW(getEdgeHammingDistance(Hypergraph(3), Hypergraph(4)), logic_error);
+}
+
+TEST(getHammingDistancesToFiles, when_samplesInFiles_expect_distancesToReference) {
+    mt19937 generator(11);
+    auto reference = getRandomHypergraph(30, generator);
+    vector<Hypergraph> sample;
+    vector<string> fileNames;
+    for (size_t i=0; i<5; i++) {
+        sample.push_back(getRandomHypergraph(30, generator));
+        fileNames.push_back("hamming_distance_test"+to_string(i));
+        sample.back().writeToBinary(fileNames.back());
+    }
+
+    for (bool global: {false, true})
+        for (size_t threadNumber: {1, 3}) {
+            auto distances = getHammingDistancesToFiles(reference, fileNames, global, threadNumber);
+            ASSERT_EQ(distances.size(), sample.size());
+            for (size_t i=0; i<sample.size(); i++)
+                EXPECT_EQ(distances[i], getHammingDistanceByEnumeration(reference, sample[i], global));
+        }
+    for (auto& fileName: fileNames) {
+        remove((fileName+"_edges").c_str());
+        remove((fileName+"_triangles").c_str());
+    }
+}
@@ -114,6 +114,23 @@ TEST_F(HypergraphTestCase, hyperedgeProposal_when_removeEdgeCoveredOrNotByTriang
     // EXPECT_DOUBLE_EQ(observationsModel({ REMOVE, FourStepsHypergraphProposal::EDGE, j, k, -1 }), 0);
 }
 
+TEST_F(HypergraphTestCase, hyperedgeProposal_when_shiftTriangle_expect_loglikelihoodDifference) {
+    PoissonHypergraphObservationsModel observationsModel(graph, parameters, observations);
+
+    SixStepsHypergraphProposal proposal;
+    proposal.move = ADD;
+    proposal.moveType = SixStepsHypergraphProposal::SHIFT;
+    proposal.chosenTriplet = {1, 3, 0};
+    proposal.shiftedTriplet = {1, 3, 4};
+
+    double initialLoglikelihood = observationsModel.getLoglikelihood();
+    double logAcceptance = observationsModel(proposal);
+    graph.removeTriangle({0, 1, 3});
+    graph.addTriangle({1, 3, 4});
+
+    EXPECT_NEAR(logAcceptance, observationsModel.getLoglikelihood()-initialLoglikelihood, 1e-10);
+}
+
 TEST_F(EdgeStrengthGraphTestCase, edgeProposal_when_addEdgeOverEveryHyperedgeType) {
     PoissonEdgeStrengthObservationsModel observationsModel(graph, parameters, observations);
 
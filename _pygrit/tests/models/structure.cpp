@@ -110,6 +110,18 @@ TEST_F(HypergraphTestCase, independentHyperedges_when_cleanTriangles) {
 }
 
 
+TEST_F(HypergraphTestCase, independentHyperedges_when_parametersUpdated_expect_newParametersAfterCacheUpdate) {
+    Parameters updatedParameters(parameters);
+    IndependentHyperedgesModel graphModel(graph, updatedParameters, observations);
+    SixStepsHypergraphProposal proposal{ ADD, SixStepsHypergraphProposal::TRIANGLE, Triplet{0, 1, 2}, std::set<Edge>{{0, 1}, {0, 2}, {1, 2}}, 0};
+
+    updatedParameters[0] = 0.4;
+    EXPECT_DOUBLE_EQ(graphModel(proposal), log(p)-log(1-p));
+    graphModel.updateParameterCache();
+    EXPECT_DOUBLE_EQ(graphModel(proposal), log(0.4)-log(0.6));
+}
+
+
 TEST_F(EdgeStrengthGraphTestCase, edgeStrength_when_addEdge) {
     EdgeStrengthGraphModel graphModel(graph, parameters, observations);
     EXPECT_THROW(graphModel({ ADD, {0, 1} }), std::logic_error);
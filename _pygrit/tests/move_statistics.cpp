@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "GRIT/utility.h"
+#include "GRIT/hypergraph.h"
+#include "GRIT/move_statistics.h"
+#include "fixtures.h"
+
+
+using namespace std;
+using namespace GRIT;
+
+
+// Only built when the library is compiled with GRIT_MOVE_STATISTICS
+static_assert(MoveStatisticsCollector::enabled, "The move statistics test requires GRIT_MOVE_STATISTICS.");
+
+static Hypergraph getTestHypergraph() {
+    Hypergraph hypergraph(8);
+    hypergraph.addTriangle({3, 4, 5});
+    hypergraph.addEdge(0, 1);
+    return hypergraph;
+}
+
+
+class MoveStatisticsTestCase: public::testing::Test{
+    public:
+        PHGPipeline pipeline;
+        HypergraphSampler& sampler;
+
+        MoveStatisticsTestCase():
+            pipeline(getTestHypergraph(), {0.05, 0.2, 0.5, 5, 10}, {0.4, 0.4, 0.2}), sampler(pipeline.hypergraphSampler)
+        {}
+
+        void SetUp() {
+            generator.seed(42);
+            sampler.resetValues();
+        }
+};
+
+
+TEST_F(MoveStatisticsTestCase, advanceOneStep_manySteps_everyStepCountedOnce) {
+    for (size_t i=0; i<2000; i++)
+        sampler.advanceOneStep();
+
+    size_t proposed = 0, accepted = 0;
+    auto& statistics = sampler.getMoveStatistics();
+    for (size_t moveType=0; moveType<MoveStatistics::MOVE_TYPE_NUMBER; moveType++)
+        for (auto move: {ADD, REMOVE}) {
+            auto& counters = statistics.get(moveType, move);
+            proposed += counters.proposed;
+            accepted += counters.accepted;
+            EXPECT_LE(counters.accepted, counters.proposed);
+            EXPECT_LE(counters.unchanged, counters.accepted);
+        }
+    EXPECT_EQ(proposed, 2000);
+    EXPECT_GT(accepted, 0);
+    EXPECT_EQ(statistics.get(SixStepsHypergraphProposal::NONE, ADD).proposed, 0);
+    EXPECT_GT(statistics.get(SixStepsHypergraphProposal::EDGE, ADD).proposed, 0);
+    EXPECT_GT(statistics.get(SixStepsHypergraphProposal::TRIANGLE, REMOVE).proposed, 0);
+    EXPECT_GT(statistics.get(SixStepsHypergraphProposal::HIDDEN_EDGES, ADD).proposed, 0);
+    EXPECT_GT(statistics.get(SixStepsHypergraphProposal::EDGE, ADD).time[MoveStatistics::PROPOSAL], 0);
+}
+
+TEST(WriteMoveStatisticsToJson, someMovesProposed_onlyProposedMovesWritten) {
+    MoveStatistics statistics;
+    statistics.counters[SixStepsHypergraphProposal::TRIANGLE][ADD].proposed = 3;
+    statistics.counters[SixStepsHypergraphProposal::TRIANGLE][ADD].accepted = 2;
+    writeMoveStatisticsToJson(statistics, "move_statistics_test.json");
+
+    stringstream content;
+    content << ifstream("move_statistics_test.json").rdbuf();
+    EXPECT_NE(content.str().find("\"triangle add\": {\"proposed\": 3, \"accepted\": 2, \"unchanged\": 0"), string::npos);
+    EXPECT_EQ(content.str().find("edge"), string::npos);
+    remove("move_statistics_test.json");
+}
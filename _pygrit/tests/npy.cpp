@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+
+#include "GRIT/npy.h"
+
+
+using namespace std;
+using namespace GRIT;
+
+
+// Writes a version 1 numpy file with the header numpy.save would produce
+template<typename T>
+static void writeNpy(const string& fileName, const string& descr, const vector<T>& values, size_t n, bool fortranOrder=false) {
+    string header = "{'descr': '"+descr+"', 'fortran_order': "+(fortranOrder ? "True" : "False")
+                    +", 'shape': ("+to_string(n)+", "+to_string(n)+"), }";
+    header.append(64 - (10+header.size()+1)%64, ' ');
+    header += '\n';
+
+    ofstream file(fileName, ios::binary);
+    file.write("\x93NUMPY\x01\x00", 8);
+    uint16_t headerLength = header.size();
+    file.write((char*) &headerLength, 2);
+    file.write(header.data(), header.size());
+    file.write((char*) values.data(), values.size()*sizeof(T));
+}
+
+
+TEST(LoadObservationsFromNpy, int64Matrix_diagonalErasedAndValuesKept) {
+    writeNpy<int64_t>("npy_test.npy", "<i8", {7, 1, 2,
+                                              1, 7, 3,
+                                              2, 3, 7}, 3);
+    auto observations = loadObservationsFromNpy("npy_test.npy");
+
+    EXPECT_EQ(observations, Observations({{0, 1, 2}, {1, 0, 3}, {2, 3, 0}}));
+    remove("npy_test.npy");
+}
+
+TEST(LoadObservationsFromNpy, boolFortranOrderMatrix_valuesKept) {
+    writeNpy<uint8_t>("npy_test.npy", "|b1", {0, 1, 0,
+                                              1, 0, 1,
+                                              0, 1, 0}, 3, true);
+    auto observations = loadObservationsFromNpy("npy_test.npy");
+
+    EXPECT_EQ(observations, Observations({{0, 1, 0}, {1, 0, 1}, {0, 1, 0}}));
+    remove("npy_test.npy");
+}
+
+TEST(LoadObservationsFromNpy, asymmetricMatrix_throwRuntimeError) {
+    writeNpy<double>("npy_test.npy", "<f8", {0, 1, 2, 0}, 2);
+
+    EXPECT_THROW(loadObservationsFromNpy("npy_test.npy"), runtime_error);
+    remove("npy_test.npy");
+}
+
+TEST(LoadObservationsFromNpy, nonIntegerValues_throwRuntimeError) {
+    writeNpy<double>("npy_test.npy", "<f8", {0, 1.5, 1.5, 0}, 2);
+
+    EXPECT_THROW(loadObservationsFromNpy("npy_test.npy"), runtime_error);
+    remove("npy_test.npy");
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "GRIT/utility.h"
+#include "GRIT/hypergraph.h"
+#include "GRIT/observations_generation.h"
+
+
+using namespace std;
+using namespace GRIT;
+
+
+static Hypergraph getTestHypergraph() {
+    Hypergraph hypergraph(200);
+    for (size_t i=0; i<200; i+=3)
+        hypergraph.addEdge(i, (i*7+1)%200);
+    hypergraph.addMultiedge(5, 6, 2);
+    hypergraph.addTriangle({10, 150, 199});
+    hypergraph.addTriangle({0, 1, 2});
+    return hypergraph;
+}
+
+static size_t getCount(const SparseMatrix<size_t>& observations, size_t i, size_t j) {
+    if (i > j)
+        swap(i, j);
+    auto it = observations[i].find(j);
+    return it == observations[i].end() ? 0 : it->second;
+}
+
+
+TEST(PoissonObservationsGenerator, when_sameGlobalSeed_expect_sameObservationsForAnyThreadNumber) {
+    auto hypergraph = getTestHypergraph();
+    PoissonObservationsGenerator generator_(hypergraph, {0.05, 3, 8}, true);
+
+    generator.seed(7);
+    auto observations = generator_.generateSparse(1);
+    generator.seed(7);
+    EXPECT_EQ(observations, generator_.generateSparse(4));
+
+    generator.seed(7);
+    auto denseObservations = generator_.generate(3);
+    for (size_t i=0; i<hypergraph.getSize(); i++)
+        for (size_t j=0; j<hypergraph.getSize(); j++)
+            EXPECT_EQ(denseObservations[i][j], i == j ? 0 : getCount(observations, i, j));
+}
+
+TEST(PoissonObservationsGenerator, when_noBackground_expect_countsOnlyOnHyperedgePairs) {
+    auto hypergraph = getTestHypergraph();
+    generator.seed(1);
+    auto observations = PoissonObservationsGenerator(hypergraph, {0, 50, 50}, true).generateSparse();
+
+    for (size_t i=0; i<hypergraph.getSize(); i++)
+        for (size_t j=i+1; j<hypergraph.getSize(); j++)
+            EXPECT_EQ(getCount(observations, i, j) > 0, hypergraph.getHighestOrderHyperedgeWith(i, j) > 0);
+}
+
+TEST(PoissonObservationsGenerator, when_pairTypes_expect_countsWithMeanOfType) {
+    auto hypergraph = getTestHypergraph();
+    const vector<double> means {0.02, 2, 6};
+    const size_t n = hypergraph.getSize();
+
+    for (bool withTriangles: {true, false}) {
+        PoissonObservationsGenerator generator_(hypergraph, means, withTriangles);
+        double sums[3] = {0, 0, 0}, pairNumbers[3] = {0, 0, 0};
+
+        generator.seed(3);
+        for (size_t replicate=0; replicate<200; replicate++) {
+            auto observations = generator_.generateSparse(2);
+            for (size_t i=0; i<n; i++)
+                for (size_t j=i+1; j<n; j++) {
+                    size_t type = min<size_t>(2, withTriangles ? hypergraph.getHighestOrderHyperedgeWith(i, j) : hypergraph.getEdgeMultiplicity(i, j));
+                    sums[type] += getCount(observations, i, j);
+                    pairNumbers[type]++;
+                }
+        }
+        for (size_t type=0; type<3; type++) {
+            double standardError = sqrt(means[type]/pairNumbers[type]);
+            EXPECT_NEAR(sums[type]/pairNumbers[type], means[type], 5*standardError);
+        }
+    }
+}
+
+TEST(PoissonObservationsGenerator, when_largeBackgroundMean_expect_poissonCounts) {
+    Hypergraph hypergraph(100);
+    PoissonObservationsGenerator generator_(hypergraph, {3}, false);
+
+    generator.seed(2);
+    auto observations = generator_.generate();
+    double sum = 0, zeros = 0, pairNumber = 100*99/2;
+    for (size_t i=0; i<100; i++)
+        for (size_t j=i+1; j<100; j++) {
+            sum += observations[i][j];
+            zeros += observations[i][j] == 0;
+        }
+    EXPECT_NEAR(sum/pairNumber, 3, 5*sqrt(3/pairNumber));
+    EXPECT_NEAR(zeros/pairNumber, exp(-3), 5*sqrt(exp(-3)/pairNumber));
+}
+
+TEST(PoissonObservationsGenerator, when_batch_expect_firstReplicateEqualToSparseObservations) {
+    auto hypergraph = getTestHypergraph();
+    const size_t n = hypergraph.getSize();
+    PoissonObservationsGenerator generator_(hypergraph, {0.05, 3, 8}, true);
+
+    generator.seed(11);
+    auto observations = generator_.generateSparse();
+    generator.seed(11);
+    vector<uint32_t> counts(3*generator_.getPairNumber(), 1);
+    generator_.generateBatch(3, counts.data(), 4);
+
+    for (size_t i=0; i<n; i++)
+        for (size_t j=i+1; j<n; j++)
+            EXPECT_EQ(counts[PoissonObservationsGenerator::getPairIndex(n, i, j)], getCount(observations, i, j));
+    EXPECT_EQ(PoissonObservationsGenerator::getPairIndex(n, n-2, n-1), generator_.getPairNumber()-1);
+
+    auto secondReplicate = counts.begin()+generator_.getPairNumber();
+    EXPECT_FALSE(equal(counts.begin(), secondReplicate, secondReplicate));
+}
+
+TEST(PoissonObservationsGenerator, when_batchWithDifferentThreadNumbers_expect_sameReplicates) {
+    auto hypergraph = getTestHypergraph();
+    PoissonObservationsGenerator generator_(hypergraph, {0.05, 3, 8}, true);
+    vector<uint32_t> counts[2];
+
+    for (size_t run=0; run<2; run++) {
+        generator.seed(5);
+        counts[run].resize(4*generator_.getPairNumber());
+        generator_.generateBatch(4, counts[run].data(), run == 0 ? 1 : 3);
+    }
+    EXPECT_EQ(counts[0], counts[1]);
+}
+
+TEST(PoissonObservationsGenerator, when_negativeMean_expect_logicError) {
+    Hypergraph hypergraph(5);
+    EXPECT_THROW(PoissonObservationsGenerator(hypergraph, {0.1, -1}, false), logic_error);
+    EXPECT_THROW(PoissonObservationsGenerator(hypergraph, {}, false), logic_error);
+}
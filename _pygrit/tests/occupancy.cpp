@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <map>
+
+#include "GRIT/utility.h"
+#include "GRIT/hypergraph.h"
+#include "GRIT/occupancy.h"
+#include "fixtures.h"
+
+
+using namespace std;
+using namespace GRIT;
+
+
+static size_t getOccurencesOf(const EdgeTypeFrequencies& edgetype, size_t i, size_t j) {
+    const auto it = edgetype[i].find(j);
+    if (it != edgetype[i].end())
+        return it->second;
+    return 0;
+}
+
+
+TEST(OccupancyAccumulator, when_triangleAddedDuringSteps_expect_stepsSinceAddition) {
+    Hypergraph hypergraph(5);
+    hypergraph.addEdge(0, 1);
+    OccupancyAccumulator accumulator(hypergraph, true);
+    accumulator.start();
+
+    SixStepsHypergraphProposal unchanged {ADD, SixStepsHypergraphProposal::EDGE, {0, 0, 0}, {}, 0, 0, {0, 0, 0}};
+    SixStepsHypergraphProposal triangleAddition {ADD, SixStepsHypergraphProposal::TRIANGLE, {1, 2, 3}, {{1, 2}, {1, 3}, {2, 3}}, 0, 3, {1, 2, 3}};
+    for (size_t i=0; i<3; i++)
+        accumulator.recordStep(unchanged, false);
+    hypergraph.addTriangle({1, 2, 3});
+    accumulator.recordStep(triangleAddition, true);
+    for (size_t i=0; i<2; i++)
+        accumulator.recordStep(unchanged, false);
+
+    auto occupancies = accumulator.getPairOccupancies();
+    EXPECT_EQ(accumulator.getStepNumber(), 6);
+    EXPECT_EQ(getOccurencesOf(occupancies.first, 0, 1), 6);
+    EXPECT_EQ(getOccurencesOf(occupancies.second, 1, 2), 3);
+    EXPECT_EQ(getOccurencesOf(occupancies.second, 2, 3), 3);
+    EXPECT_EQ(getOccurencesOf(occupancies.first, 1, 2), 0);
+
+    auto triangleOccupancies = accumulator.getTriangleOccupancies();
+    ASSERT_EQ(triangleOccupancies.size(), 1);
+    EXPECT_EQ(triangleOccupancies[0].first, Triplet({1, 2, 3}));
+    EXPECT_EQ(triangleOccupancies[0].second, 3);
+}
+
+TEST(OccupancyAccumulator, when_edgeMultiplicityChanges_expect_stepsInEachMultiplicity) {
+    Hypergraph hypergraph(3);
+    OccupancyAccumulator accumulator(hypergraph, false);
+    accumulator.start();
+
+    TwoStepsEdgeProposal addition {ADD, {0, 2}, false};
+    hypergraph.addEdge(0, 2);
+    accumulator.recordStep(addition, true);
+    accumulator.recordStep(addition, false);
+    hypergraph.addEdge(0, 2);
+    accumulator.recordStep(addition, true);
+    accumulator.recordStep(addition, false);
+    hypergraph.removeEdge(0, 2);
+    accumulator.recordStep(addition, true);
+
+    auto fractions = accumulator.getPairOccupancyFractions();
+    EXPECT_DOUBLE_EQ(fractions.first[0][2], 0.6);
+    EXPECT_DOUBLE_EQ(fractions.second[0][2], 0.4);
+}
+
+TEST(OccupancyAccumulator, when_notStarted_expect_noStepRecorded) {
+    Hypergraph hypergraph(3);
+    OccupancyAccumulator accumulator(hypergraph, true);
+    accumulator.recordStep(TwoStepsEdgeProposal{ADD, {0, 1}, false}, true);
+
+    EXPECT_FALSE(accumulator.isRecording());
+    EXPECT_EQ(accumulator.getStepNumber(), 0);
+}
+
+TEST(OccupancyAccumulator, when_metropolisHastingsSteps_expect_sameOccupanciesAsCountingEveryStep) {
+    Hypergraph initialHypergraph(8);
+    initialHypergraph.addEdge(0, 1);
+    initialHypergraph.addTriangle({3, 4, 5});
+    PHGPipeline pipeline(initialHypergraph, {0.05, 0.2, 0.5, 8, 10}, {0.35, 0.35, 0.1, 0, 0.2});
+    const Hypergraph& hypergraph = pipeline.hypergraph;
+    HypergraphSampler& hypergraphSampler = pipeline.hypergraphSampler;
+
+    OccupancyAccumulator accumulator(hypergraph, true);
+    hypergraphSampler.setOccupancyAccumulator(&accumulator);
+    hypergraphSampler.resetValues();
+    for (size_t step=0; step<100; step++)  // Not recorded before the start
+        hypergraphSampler.advanceOneStep();
+    accumulator.start();
+
+    const size_t stepNumber = 5000;
+    EdgeTypeFrequencies expectedOccupancies[2] = {EdgeTypeFrequencies(8), EdgeTypeFrequencies(8)};
+    map<array<size_t, 3>, size_t> expectedTriangleOccupancies;
+    for (size_t step=0; step<stepNumber; step++) {
+        hypergraphSampler.advanceOneStep();
+        for (size_t i=0; i<8; i++)
+            for (size_t j=i+1; j<8; j++) {
+                size_t type = hypergraph.getHighestOrderHyperedgeWith(i, j);
+                if (type > 0)
+                    expectedOccupancies[type-1][i][j]++;
+            }
+        for (auto& triplet: hypergraph.getFullTriangleList()) {
+            auto ordered = triplet.getOrdered();
+            expectedTriangleOccupancies[{ordered.i, ordered.j, ordered.k}]++;
+        }
+    }
+
+    auto occupancies = accumulator.getPairOccupancies();
+    EXPECT_EQ(accumulator.getStepNumber(), stepNumber);
+    EXPECT_EQ(occupancies.first, expectedOccupancies[0]);
+    EXPECT_EQ(occupancies.second, expectedOccupancies[1]);
+
+    map<array<size_t, 3>, size_t> triangleOccupancies;
+    for (auto& triplet_steps: accumulator.getTriangleOccupancies())
+        triangleOccupancies[{triplet_steps.first.i, triplet_steps.first.j, triplet_steps.first.k}] = triplet_steps.second;
+    EXPECT_EQ(triangleOccupancies, expectedTriangleOccupancies);
+}
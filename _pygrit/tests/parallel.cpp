@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "GRIT/utility.h"
+#include "GRIT/parallel.h"
+
+
+using namespace std;
+using namespace GRIT;
+
+
+TEST(runInParallel, when_manyTasks_expect_everyTaskRunOnce) {
+    vector<atomic<size_t>> calls(1000);
+    runInParallel(calls.size(), [&](size_t task) { calls[task]++; }, 4);
+
+    for (auto& taskCalls: calls)
+        EXPECT_EQ(taskCalls, 1);
+}
+
+TEST(runInParallel, when_taskThrows_expect_exceptionRethrown) {
+    EXPECT_THROW(runInParallel(100, [](size_t task) {
+                if (task == 42)
+                    throw runtime_error("Task failed");
+            }, 4), runtime_error);
+}
+
+TEST(TaskGenerators, when_sameGlobalSeed_expect_sameStreamsForAnyThreadNumber) {
+    vector<uint32_t> draws[2];
+    for (size_t threadNumber: {1, 4}) {
+        generator.seed(42);
+        TaskGenerators taskGenerators;
+        auto& runDraws = draws[threadNumber == 1 ? 0 : 1];
+        runDraws.resize(64);
+        runInParallel(runDraws.size(), [&](size_t task) { runDraws[task] = taskGenerators.get(task)(); }, threadNumber);
+    }
+    EXPECT_EQ(draws[0], draws[1]);
+    EXPECT_NE(draws[0][0], draws[0][1]);
+}
+
+TEST(getThreadNumber, when_fewerTasksThanThreads_expect_oneThreadPerTask) {
+    EXPECT_EQ(getThreadNumber(8, 3), 3);
+    EXPECT_EQ(getThreadNumber(2, 3), 2);
+    EXPECT_EQ(getThreadNumber(8, 0), 1);
+    EXPECT_GE(getThreadNumber(0, 100), 1);
+}
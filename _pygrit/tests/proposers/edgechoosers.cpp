@@ -4,6 +4,7 @@
 #include "GRIT/proposers/edge-choosers/uniform_edge_chooser.h"
 #include "GRIT/proposers/edge-choosers/weighted_unique_chooser.h"
 #include "GRIT/proposers/edge-choosers/weighted_two-layers_chooser.h"
+#include "GRIT/proposers/edge-choosers/weighted_pair_chooser.h"
 
 
 using namespace std;
@@ -346,3 +347,18 @@ TEST_F(HypergraphAndObservationsTestCase, twoLayersWeighted_expect_edgeAddedToDi
 
     VERIFY_PROBS_TWOLAYERSWEIGHTED
 }
+
+TEST_F(HypergraphAndObservationsTestCase, pairWeighted_expect_sameProbabilitiesForEdgesAndNonEdges) {
+    ObservationsWeightedPairChooser chooser(observations);
+
+    double weightSum = 0;
+    for_ij_in_observations
+        weightSum += observations[i][j]+1;
+
+    for_ij_in_observations {
+        double weight = observations[i][j]+1;
+        EXPECT_DOUBLE_EQ_BOTH_DIRECTIONS(weight/weightSum, getForwardProbability, ADD);
+        EXPECT_DOUBLE_EQ_BOTH_DIRECTIONS(weight/weightSum, getReverseProbability, ADD);
+        EXPECT_DOUBLE_EQ_BOTH_DIRECTIONS(weight/weightSum, getReverseProbability, REMOVE);
+    }
+}
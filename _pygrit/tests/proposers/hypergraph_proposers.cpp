@@ -4,6 +4,7 @@
 #include "GRIT/proposers/sixsteps_hypergraph.h"
 #include "GRIT/proposers/edge-choosers/weighted_unique_chooser.h"
 #include "GRIT/proposers/edge-choosers/uniform_edge_chooser.h"
+#include "GRIT/proposers/edge-choosers/weighted_pair_chooser.h"
 #include "GRIT/proposers/triangle-choosers/observations_by_pairs_chooser.h"
 #include "GRIT/proposers/triangle-choosers/uniform_triangle_chooser.h"
 
@@ -319,3 +320,111 @@ TEST_F(SixStepsHypergraph_testCase, when_dirtyingTriangles_expect_correctProposa
             + log(1-eta)-log(eta),
             0.00001);
 }
+
+TEST_F(SixStepsHypergraph_testCase, when_proposingPair_expect_edgeStateFlippedWithoutProposalContribution) {
+    ObservationsWeightedUniqueEdgeChooser edgeAdder(observations, hypergraph);
+    UniformNonEdgeChooser edgeRemover(hypergraph);
+    ObservationsPairwiseTriangleChooser triangleAdder(observations);
+    UniformTriangleChooser triangleRemover(hypergraph);
+    ObservationsWeightedPairChooser pairChooser(observations);
+
+    HypergraphSixStepsProposer proposer(hypergraph, parameters, observations, triangleAdder, triangleRemover, edgeAdder, edgeRemover, {0, 0, 0, 1}, eta, chi_0, chi_1);
+    proposer.setPairChooser(pairChooser);
+
+    for (size_t step=0; step<20; step++) {
+        proposer.generateProposal();
+        const auto& i = proposer.currentProposal.chosenTriplet.i;
+        const auto& j = proposer.currentProposal.chosenTriplet.j;
+
+        EXPECT_EQ(proposer.currentProposal.moveType, SixStepsHypergraphProposal::PAIR);
+        EXPECT_EQ(proposer.currentProposal.move, hypergraph.isEdge(i, j) ? REMOVE : ADD);
+        EXPECT_DOUBLE_EQ(proposer.getLogAcceptanceContribution(), 0);
+    }
+}
+
+TEST_F(SixStepsHypergraph_testCase, when_proposingPairWithoutPairChooser_expect_logicError) {
+    ObservationsWeightedUniqueEdgeChooser edgeAdder(observations, hypergraph);
+    UniformNonEdgeChooser edgeRemover(hypergraph);
+    ObservationsPairwiseTriangleChooser triangleAdder(observations);
+    UniformTriangleChooser triangleRemover(hypergraph);
+
+    HypergraphSixStepsProposer proposer(hypergraph, parameters, observations, triangleAdder, triangleRemover, edgeAdder, edgeRemover, {0, 0, 0, 1}, eta, chi_0, chi_1);
+    EXPECT_THROW(proposer.generateProposal(), logic_error);
+}
+
+TEST_F(SixStepsHypergraph_testCase, when_shiftWithNonUniformTriangleRemover_expect_logicError) {
+    ObservationsWeightedUniqueEdgeChooser edgeAdder(observations, hypergraph);
+    UniformNonEdgeChooser edgeRemover(hypergraph);
+    ObservationsPairwiseTriangleChooser triangleAdder(observations);
+    UniformTriangleChooser triangleRemover(hypergraph);
+
+    EXPECT_THROW(HypergraphSixStepsProposer(hypergraph, parameters, observations, triangleAdder, triangleAdder, edgeAdder, edgeRemover,
+                                            {0.5, 0.3, 0.1, 0, 0.1}, eta, chi_0, chi_1), logic_error);
+    EXPECT_NO_THROW(HypergraphSixStepsProposer(hypergraph, parameters, observations, triangleAdder, triangleAdder, edgeAdder, edgeRemover,
+                                               {0.5, 0.3, 0.2, 0, 0}, eta, chi_0, chi_1));
+    EXPECT_NO_THROW(HypergraphSixStepsProposer(hypergraph, parameters, observations, triangleAdder, triangleRemover, edgeAdder, edgeRemover,
+                                               {0.5, 0.3, 0.1, 0, 0.1}, eta, chi_0, chi_1));
+}
+
+TEST_F(SixStepsHypergraph_testCase, when_proposingTriangleShift_expect_shiftedVertexWeightsRatio) {
+    for (auto& row: observations)
+        row.resize(8, 0);
+    observations.resize(8, vector<size_t>(8, 0));
+    ObservationsWeightedUniqueEdgeChooser edgeAdder(observations, hypergraph);
+    UniformNonEdgeChooser edgeRemover(hypergraph);
+    ObservationsPairwiseTriangleChooser triangleAdder(observations);
+    UniformTriangleChooser triangleRemover(hypergraph);
+
+    HypergraphSixStepsProposer proposer(hypergraph, parameters, observations, triangleAdder, triangleRemover, edgeAdder, edgeRemover, {0, 0, 0, 0, 1}, eta, chi_0, chi_1);
+
+    for (size_t step=0; step<20; step++) {
+        proposer.generateProposal();
+        const auto& proposal = proposer.currentProposal;
+        const auto& i = proposal.chosenTriplet.i, j = proposal.chosenTriplet.j, k = proposal.chosenTriplet.k;
+        const auto& l = proposal.shiftedTriplet.k;
+
+        EXPECT_EQ(proposal.moveType, SixStepsHypergraphProposal::SHIFT);
+        EXPECT_TRUE(hypergraph.isTriangle(proposal.chosenTriplet));
+        EXPECT_EQ(proposal.shiftedTriplet.i, i);
+        EXPECT_EQ(proposal.shiftedTriplet.j, j);
+        EXPECT_TRUE(l != i && l != j && l != k);
+
+        double totalWeight = 0;
+        for (size_t vertex=0; vertex<8; vertex++)
+            if (vertex != i && vertex != j)
+                totalWeight += observations[i][vertex] + observations[j][vertex] + 1;
+        double w_k = observations[i][k] + observations[j][k] + 1;
+        double w_l = observations[i][l] + observations[j][l] + 1;
+
+        if (hypergraph.isTriangle(proposal.shiftedTriplet))
+            EXPECT_EQ(proposer.getLogAcceptanceContribution(), -INFINITY);
+        else
+            EXPECT_NEAR(proposer.getLogAcceptanceContribution(),
+                    log(w_k) - log(totalWeight-w_l) - log(w_l) + log(totalWeight-w_k), 1e-10);
+    }
+}
+
+TEST_F(SixStepsHypergraph_testCase, when_applyingTriangleShift_expect_triangleMoved) {
+    for (auto& row: observations)
+        row.resize(8, 0);
+    observations.resize(8, vector<size_t>(8, 0));
+    ObservationsWeightedUniqueEdgeChooser edgeAdder(observations, hypergraph);
+    UniformNonEdgeChooser edgeRemover(hypergraph);
+    ObservationsPairwiseTriangleChooser triangleAdder(observations);
+    UniformTriangleChooser triangleRemover(hypergraph);
+
+    HypergraphSixStepsProposer proposer(hypergraph, parameters, observations, triangleAdder, triangleRemover, edgeAdder, edgeRemover, {0, 0, 0, 0, 1}, eta, chi_0, chi_1);
+
+    SixStepsHypergraphProposal proposal;
+    proposal.move = ADD;
+    proposal.moveType = SixStepsHypergraphProposal::SHIFT;
+    proposal.chosenTriplet = {3, 4, 5};
+    proposal.shiftedTriplet = {3, 4, 7};
+    proposer.setProposal(proposal);
+
+    EXPECT_TRUE(proposer.applyStep());
+    EXPECT_FALSE(hypergraph.isTriangle({3, 4, 5}));
+    EXPECT_TRUE(hypergraph.isTriangle({3, 4, 7}));
+    EXPECT_EQ(hypergraph.getTriangleNumber(), 3);
+    EXPECT_DOUBLE_EQ(triangleRemover.getForwardProbability({3, 4, 7}, REMOVE), 1./3);
+}
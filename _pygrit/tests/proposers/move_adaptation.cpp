@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+
+#include "GRIT/utility.h"
+#include "GRIT/proposers/move_adaptation.h"
+
+
+using namespace std;
+using namespace GRIT;
+
+
+static void recordSteps(MoveAdaptation& adaptation, size_t moveType, size_t stepNumber, double squaredJump, double cost) {
+    for (size_t i=0; i<stepNumber; i++)
+        adaptation.recordStep(moveType, AddRemoveMove(i%2), 0, squaredJump, cost);
+}
+
+
+TEST(MoveAdaptation, when_moveTypeJumpsFarther_expect_moveTypeMoreProbable) {
+    MoveAdaptation adaptation({0.5, 0.5, 0}, 0.5);
+    recordSteps(adaptation, 0, MoveAdaptation::UPDATE_INTERVAL/2, 4, 1);
+    recordSteps(adaptation, 1, MoveAdaptation::UPDATE_INTERVAL/2, 1, 1);
+
+    auto& moveProbabilities = adaptation.getMoveProbabilities();
+    EXPECT_NEAR(moveProbabilities[0], 0.9*0.8+0.05, 1e-9);
+    EXPECT_NEAR(moveProbabilities[1], 0.9*0.2+0.05, 1e-9);
+    EXPECT_EQ(moveProbabilities[2], 0);
+}
+
+TEST(MoveAdaptation, when_movesAreCostlier_expect_lessProbableMoves) {
+    MoveAdaptation adaptation({0.5, 0.5}, 0.5);
+    recordSteps(adaptation, 0, MoveAdaptation::UPDATE_INTERVAL/2, 1, 1000);
+    recordSteps(adaptation, 1, MoveAdaptation::UPDATE_INTERVAL/2, 1, 1);
+
+    EXPECT_LT(adaptation.getMoveProbabilities()[0], adaptation.getMoveProbabilities()[1]);
+}
+
+TEST(MoveAdaptation, when_additionsAreRejected_expect_etaFavorsRemovals) {
+    MoveAdaptation adaptation({1}, 0.5);
+    for (size_t i=0; i<MoveAdaptation::UPDATE_INTERVAL; i++)
+        adaptation.recordStep(0, AddRemoveMove(i%2), i%2 ? -5 : 5, 1, 1);
+
+    EXPECT_NEAR(adaptation.getEta(), MoveAdaptation::MINIMUM_ETA, 1e-9);
+}
+
+TEST(MoveAdaptation, when_fewStepsRecorded_expect_initialValues) {
+    MoveAdaptation adaptation({1, 3}, 0.3);
+    recordSteps(adaptation, 0, MoveAdaptation::UPDATE_INTERVAL-1, 1, 1);
+
+    EXPECT_EQ(adaptation.getMoveProbabilities(), vector<double>({0.25, 0.75}));
+    EXPECT_EQ(adaptation.getEta(), 0.3);
+}
+
+TEST(MoveAdaptation, when_stateRead_expect_sameAdaptation) {
+    MoveAdaptation adaptation({0.5, 0.5}, 0.5), restoredAdaptation({0.5, 0.5}, 0.5);
+    recordSteps(adaptation, 0, MoveAdaptation::UPDATE_INTERVAL+10, 2, 1);
+
+    stringstream state;
+    adaptation.writeState(state);
+    restoredAdaptation.readState(state);
+    recordSteps(adaptation, 1, MoveAdaptation::UPDATE_INTERVAL, 1, 1);
+    recordSteps(restoredAdaptation, 1, MoveAdaptation::UPDATE_INTERVAL, 1, 1);
+
+    EXPECT_EQ(adaptation.getMoveProbabilities(), restoredAdaptation.getMoveProbabilities());
+    EXPECT_EQ(adaptation.getEta(), restoredAdaptation.getEta());
+}
+
+// State of a two move type adaptation with "ratioNumber" removal ratios and no addition ratio
+static string getStateWithRatioPosition(size_t ratioNumber, size_t ratioPosition) {
+    stringstream state;
+    for (size_t i=0; i<3; i++) {
+        writeBinaryValue(state, (size_t) 2);
+        writeBinaryValue(state, 0.5);
+        writeBinaryValue(state, 0.5);
+    }
+    writeBinaryValue(state, ratioNumber);
+    for (size_t i=0; i<ratioNumber; i++)
+        writeBinaryValue(state, 0.);
+    writeBinaryValue(state, ratioPosition);
+    writeBinaryValue(state, (size_t) 0);
+    writeBinaryValue(state, (size_t) 0);
+    writeBinaryValue(state, 0.5);
+    writeBinaryValue(state, (size_t) 0);
+    return state.str();
+}
+
+TEST(MoveAdaptation, when_stateHasInvalidRatioPosition_expect_runtimeError) {
+    MoveAdaptation adaptation({0.5, 0.5}, 0.5);
+
+    stringstream validState(getStateWithRatioPosition(3, 3));
+    EXPECT_NO_THROW(adaptation.readState(validState));
+
+    stringstream positionBeyondBuffer(getStateWithRatioPosition(MoveAdaptation::RATIO_BUFFER_SIZE, MoveAdaptation::RATIO_BUFFER_SIZE));
+    EXPECT_THROW(adaptation.readState(positionBeyondBuffer), runtime_error);
+    stringstream positionBeyondRatios(getStateWithRatioPosition(3, 10));
+    EXPECT_THROW(adaptation.readState(positionBeyondRatios), runtime_error);
+}
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+
+#include "GRIT/utility.h"
+#include "GRIT/hypergraph.h"
+#include "GRIT/sample_writer.h"
+#include "GRIT/sample_reader.h"
+
+
+using namespace std;
+using namespace GRIT;
+
+
+static Hypergraph getTestHypergraph() {
+    Hypergraph hypergraph(6);
+    hypergraph.addTriangle({0, 1, 2});
+    hypergraph.addTriangle({1, 2, 5});
+    hypergraph.addTriangle({3, 4, 5});
+    hypergraph.addMultiedge(0, 3, 2);
+    hypergraph.addEdge(4, 1);
+    return hypergraph;
+}
+
+static void expectSameHypergraphs(const Hypergraph& hypergraph1, const Hypergraph& hypergraph2) {
+    ASSERT_EQ(hypergraph1.getSize(), hypergraph2.getSize());
+    EXPECT_EQ(hypergraph1.getEdgeNumber(), hypergraph2.getEdgeNumber());
+    EXPECT_EQ(hypergraph1.getTriangleNumber(), hypergraph2.getTriangleNumber());
+
+    size_t n = hypergraph1.getSize();
+    for (size_t i=0; i<n; i++)
+        for (size_t j=i+1; j<n; j++) {
+            EXPECT_EQ(hypergraph1.getEdgeMultiplicity(i, j), hypergraph2.getEdgeMultiplicity(i, j));
+            for (size_t k=j+1; k<n; k++)
+                EXPECT_EQ(hypergraph1.isTriangle({i, j, k}), hypergraph2.isTriangle({i, j, k}));
+        }
+}
+
+static Parameters readParameters(const string& fileName, size_t n) {
+    ifstream fileStream(fileName, ios::in|ios::binary);
+    Parameters parameters(n);
+    fileStream.read((char*) parameters.data(), n*sizeof(double));
+    return parameters;
+}
+
+
+TEST(HypergraphSnapshot, writeToBinary_anyHypergraph_loadedHypergraphIsIdentical) {
+    auto hypergraph = getTestHypergraph();
+    HypergraphSnapshot(hypergraph).writeToBinary("snapshot_test");
+
+    expectSameHypergraphs(Hypergraph::loadFromBinary("snapshot_test"), hypergraph);
+
+    remove("snapshot_test_edges");
+    remove("snapshot_test_triangles");
+}
+
+TEST(AsyncSampleWriter, push_moreSamplesThanCapacity_allSamplesWrittenAfterFlush) {
+    auto hypergraph = getTestHypergraph();
+    AsyncSampleWriter writer(2);
+
+    for (size_t i=0; i<5; i++) {
+        hypergraph.addEdge(0, i+1);
+        writer.push({HypergraphSnapshot(hypergraph), {(double) i, 1.5}, "async_graph"+to_string(i), "async_param"+to_string(i)});
+    }
+    writer.flush();
+
+    auto expectedHypergraph = getTestHypergraph();
+    for (size_t i=0; i<5; i++) {
+        expectedHypergraph.addEdge(0, i+1);
+        expectSameHypergraphs(Hypergraph::loadFromBinary("async_graph"+to_string(i)), expectedHypergraph);
+        EXPECT_EQ(readParameters("async_param"+to_string(i), 2), Parameters({(double) i, 1.5}));
+
+        remove(("async_graph"+to_string(i)+"_edges").c_str());
+        remove(("async_graph"+to_string(i)+"_triangles").c_str());
+        remove(("async_param"+to_string(i)).c_str());
+    }
+}
+
+TEST(AsyncSampleWriter, flush_unwritableFile_throwRuntimeError) {
+    auto hypergraph = getTestHypergraph();
+    AsyncSampleWriter writer;
+
+    writer.push({HypergraphSnapshot(hypergraph), {1}, "./inexistent_directory/graph", "./inexistent_directory/param"});
+    EXPECT_THROW(writer.flush(), runtime_error);
+}
+
+static void writeChainSamples(SampleFormat format) {
+    auto hypergraph = getTestHypergraph();
+    AsyncSampleWriter writer;
+
+    for (size_t i=0; i<3; i++) {
+        if (i == 1)  // Second sample doesn't exist
+            continue;
+        hypergraph.addEdge(0, i+1);
+        writer.push({HypergraphSnapshot(hypergraph), {(double) i, 2.}, "hypergraph4_"+to_string(i)+".bin", "parameters4_"+to_string(i)+".bin", format});
+    }
+    writer.flush();
+}
+
+static void removeChainSamples() {
+    for (size_t i=0; i<3; i++) {
+        remove(("hypergraph4_"+to_string(i)+".bin").c_str());
+        remove(("hypergraph4_"+to_string(i)+".bin_edges").c_str());
+        remove(("hypergraph4_"+to_string(i)+".bin_triangles").c_str());
+        remove(("parameters4_"+to_string(i)+".bin").c_str());
+    }
+}
+
+static void expectChainSamplesRead(const ChainSampleReader& reader) {
+    ASSERT_EQ(reader.getSampleNumber(), 2);
+    EXPECT_EQ(reader.getSize(), 6);
+    EXPECT_EQ(reader.getIteration(1), 2);
+    EXPECT_EQ(reader.getParameters(), vector<double>({0, 2, 2, 2}));
+
+    EXPECT_EQ(reader.getEdgeNumber(1), 3);
+    EXPECT_EQ(reader.getTriangleNumber(1), 3);
+    EXPECT_EQ(vector<uint32_t>(reader.getEdges(1), reader.getEdges(1)+9), vector<uint32_t>({0, 1, 1, 0, 3, 3, 1, 4, 1}));
+    EXPECT_EQ(vector<uint32_t>(reader.getTriangles(1), reader.getTriangles(1)+9), vector<uint32_t>({0, 1, 2, 1, 2, 5, 3, 4, 5}));
+
+    vector<int8_t> types(2*15);
+    reader.fillPairTypes(types.data(), true);
+    vector<int8_t> expectedTypes {2, 2, 1, 0, 0,
+                                     2, 0, 1, 2,
+                                        0, 0, 2,
+                                           2, 2,
+                                              2};
+    EXPECT_EQ(vector<int8_t>(types.begin()+15, types.end()), expectedTypes);
+
+    expectSameHypergraphs(reader.getHypergraph(0), [] { auto h=getTestHypergraph(); h.addEdge(0, 1); return h; }());
+}
+
+TEST(ChainSampleReader, constructor_separateFilesSamples_samplesRead) {
+    writeChainSamples(SampleFormat::SEPARATE_FILES);
+    expectChainSamplesRead(ChainSampleReader(".", 4, 3));
+    removeChainSamples();
+}
+
+TEST(ChainSampleReader, constructor_compressedSamples_samplesRead) {
+    writeChainSamples(SampleFormat::COMPRESSED);
+    expectChainSamplesRead(ChainSampleReader(".", 4, 3));
+    removeChainSamples();
+}
+
+TEST(ChainSampleReader, constructor_compactSamples_samplesRead) {
+    writeChainSamples(SampleFormat::COMPACT);
+    expectChainSamplesRead(ChainSampleReader(".", 4, 3));
+    removeChainSamples();
+}
+
+TEST(ChainSampleReader, readOccurences_writtenOccurences_denseMatricesRead) {
+    EXPECT_FALSE(ChainSampleReader::hasOccurences(".", 4));
+
+    SparseMatrix<size_t> edgetype1(3), edgetype2(3);
+    edgetype1[0][1] = 5;
+    edgetype1[1][2] = 2;
+    edgetype2[0][2] = 7;
+    writeSparseMatrixToBinary(edgetype1, getOccurencesFileName("./", 4, 1));
+    writeSparseMatrixToBinary(edgetype2, getOccurencesFileName("./", 4, 2));
+
+    ASSERT_TRUE(ChainSampleReader::hasOccurences(".", 4));
+    auto occurences = ChainSampleReader::readOccurences(".", 4);
+    EXPECT_EQ(occurences.size, 3);
+    EXPECT_EQ(occurences.edgetype1, vector<size_t>({0, 5, 0, 0, 0, 2, 0, 0, 0}));
+    EXPECT_EQ(occurences.edgetype2, vector<size_t>({0, 0, 7, 0, 0, 0, 0, 0, 0}));
+    EXPECT_EQ(occurences.sampleNumber, 0);
+
+    remove(getOccurencesFileName("./", 4, 1).c_str());
+    remove(getOccurencesFileName("./", 4, 2).c_str());
+}
+
+TEST(ChainSampleReader, readOccurences_chainOccurencesWritten_sampleNumberRead) {
+    SparseMatrix<size_t> edgetype1(3), edgetype2(3);
+    edgetype1[0][1] = 5;
+    writeChainOccurences(edgetype1, edgetype2, 12, "./", 4);
+
+    auto occurences = ChainSampleReader::readOccurences(".", 4);
+    EXPECT_EQ(occurences.edgetype1, vector<size_t>({0, 5, 0, 0, 0, 0, 0, 0, 0}));
+    EXPECT_EQ(occurences.sampleNumber, 12);
+
+    remove(getOccurencesFileName("./", 4, 1).c_str());
+    remove(getOccurencesFileName("./", 4, 2).c_str());
+    remove(getOccurencesSampleNumberFileName("./", 4).c_str());
+}
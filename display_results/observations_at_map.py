@@ -42,7 +42,7 @@ for model in inference_models:
     n = hypergraph.get_size()
     models_posterior_observations[model.name] = {"std": {}, "mean": {}}
     for chain in find_chains(sample_directory):
-        prob0, prob1, prob2 = get_edgetype_probabilities_of_chain(chain, sample_directory, sample_size)
+        prob0, prob1, prob2 = get_edgetype_probabilities_of_chain(chain, sample_directory)
 
         for i, j in zip(*np.triu_indices(n, 1)):
             x_ij = observations[i, j]
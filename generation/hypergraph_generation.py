@@ -90,7 +90,7 @@ def generate_hypergraph(hypergraph_size, hypergraph_process, hypergraph_paramete
                     f"Hypergraph model \"{hypergraph_process}\" requires the following format: "
                     "\"[2-edge propensity average], [2-edge propensity std], "
                     "\"[3-edge propensity average], [3-edge propensity std]]\"")
-        return pygrit.generate_beta_model_hypergraph_normal(hypergraph_size, *hypergraph_parameters)
+        return pygrit.generate_beta_model_hypergraph_normal_skipping(hypergraph_size, *hypergraph_parameters)
 
     elif hypergraph_process == "miller CM":
         if not isinstance(hypergraph_parameters, list) or len(hypergraph_parameters) != 2:
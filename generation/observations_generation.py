@@ -84,14 +84,25 @@ def transfer_observation_data_to_binary(config, dataset_name):
     return observations
 
 
-def generate_observations(hypergraph, observation_process, observation_parameters, with_correlation):
+def verify_observation_parameters(observation_process, observation_parameters):
     if observation_process == "poisson dominant hyperedge":
         if not isinstance(observation_parameters, list) or len(observation_parameters) != 3:
             raise InvalidConfiguration("Incorrect observation parameters. "
                     f"Observation process \"{observation_process}\" needs to be a list of 3 floats.")
+    else:
+        raise InvalidConfiguration(f"Unknown observation process \"{observation_process}\".")
+
+
+def generate_observations(hypergraph, observation_process, observation_parameters, with_correlation):
+    verify_observation_parameters(observation_process, observation_parameters)
+    return pygrit.generate_poisson_observations(hypergraph, *observation_parameters, with_correlation)
+
 
-        return pygrit.generate_poisson_observations(hypergraph, *observation_parameters, with_correlation)
-    raise InvalidConfiguration(f"Unknown observation process \"{observation_process}\".")
+def generate_observations_batch(hypergraph, observation_process, observation_parameters, with_correlation, replicate_number):
+    """Replicates of the counts of the pairs (i, j), i<j, as a (replicate_number, n(n-1)/2) uint32 array."""
+    verify_observation_parameters(observation_process, observation_parameters)
+    return pygrit.generate_poisson_observations_batch(hypergraph, observation_parameters, replicate_number,
+                                                      with_triangles=with_correlation)
 
 
 def generate_and_write_observations(hypergraph, config, dataset_name, with_correlation):
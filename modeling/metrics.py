@@ -3,6 +3,7 @@ import numpy as np
 from numpy.core.numeric import NaN
 from numpy.lib.twodim_base import triu_indices
 
+from .models import get_observations_from_pair_counts
 from .output import find_chains, get_sample_of_chain, get_edgetype_probabilities_of_chain, write_metrics
 import pygrit
 
@@ -89,59 +90,61 @@ def get_upper_triangular_array(arr):
     return arr[np.triu_indices_from(arr, k=1)]
 
 
-class SumResiduals:
-    name = "sum residuals"
+class ResidualsOfTypes:
+    """Sums of residuals over the pairs of each ground truth type, or over the whole observation
+    matrix without ground truth. Replicates are compared in one pass as arrays of pair counts."""
+    absolute = False
 
     def __init__(self, observations, with_correlation=True, hypergraph_groundtruth=None):
-        self.observations = observations
+        self.observations = get_upper_triangular_array(observations).astype(np.uint32)
         self.metric = []
         self.true_edgetypes = None
 
         if hypergraph_groundtruth is not None:
-            self.true_edgetypes = get_edgetypes(hypergraph_groundtruth, with_correlation)
+            self.true_edgetypes = np.array(get_edgetypes(hypergraph_groundtruth, with_correlation), dtype=np.int8)
+        else:
+            # Replicates are symmetric with an empty diagonal, so the residuals of the whole matrix are
+            # those of both triangles plus the diagonal of the observations.
+            self.lower_observations = get_upper_triangular_array(observations.T).astype(np.uint32)
+            if np.array_equal(self.lower_observations, self.observations):
+                self.lower_observations = None
+            self.diagonal_sum = np.trace(observations.astype(np.int64))
+            self.all_pairs_type = np.zeros(len(self.observations), dtype=np.int8)
 
     def setup(self, hypergraph, parameters):
         pass
 
     def compute_with(self, posterior_observations):
-        if self.true_edgetypes is None:
-            self.metric.append(np.sum(self.observations-posterior_observations))
+        self.compute_with_batch(get_upper_triangular_array(posterior_observations)[np.newaxis])
 
+    def compute_with_batch(self, posterior_pair_counts):
+        if self.true_edgetypes is not None:
+            sums, absolute_sums = pygrit.get_residuals_of_types(self.true_edgetypes, self.observations, posterior_pair_counts)
+            self.metric.extend(absolute_sums if self.absolute else sums)
+            return
+
+        residuals = self._get_residuals_of_all_pairs(self.observations, posterior_pair_counts)
+        if self.lower_observations is None:
+            residuals *= 2
         else:
-            self.metric.append(
-                pygrit.get_sum_residuals_of_types(self.true_edgetypes, self.observations, posterior_observations)
-            )
+            residuals += self._get_residuals_of_all_pairs(self.lower_observations, posterior_pair_counts)
+        self.metric.extend(residuals + self.diagonal_sum)
+
+    def _get_residuals_of_all_pairs(self, observations, posterior_pair_counts):
+        sums, absolute_sums = pygrit.get_residuals_of_types(self.all_pairs_type, observations, posterior_pair_counts)
+        return (absolute_sums if self.absolute else sums)[:, 0]
 
     def get_metric(self):
         return np.array(self.metric).T
 
 
-class SumAbsoluteResiduals:
-    name = "sum absolute residuals"
-
-    def __init__(self, observations, with_correlation=True, hypergraph_groundtruth=None):
-        self.observations = observations
-        self.metric = []
-        self.true_edgetypes = None
-
-        if hypergraph_groundtruth is not None:
-            self.true_edgetypes = get_edgetypes(hypergraph_groundtruth, with_correlation)
-
-
-    def setup(self, hypergraph, parameters):
-        pass
-
-    def compute_with(self, posterior_observations):
-        if self.true_edgetypes is None:
-            self.metric.append(np.sum(np.abs(self.observations-posterior_observations)))
+class SumResiduals(ResidualsOfTypes):
+    name = "sum residuals"
 
-        else:
-            self.metric.append(
-                pygrit.get_sum_absolute_residuals_of_types(self.true_edgetypes, self.observations, posterior_observations)
-            )
 
-    def get_metric(self):
-        return np.array(self.metric).T
+class SumAbsoluteResiduals(ResidualsOfTypes):
+    name = "sum absolute residuals"
+    absolute = True
 
 
 class WAIC:
@@ -247,9 +250,18 @@ def compute_metrics(sample_directory, sample_size, inference_model, observations
                 for metric in metrics["posterior_predictive_metrics"]:
                     metric.setup(hypergraph, parameters)
 
-                for i in range(observations_per_sample):
-                    posterior_observations = inference_model.generate_observations(hypergraph, parameters)
-                    compute_metrics_with(metrics["posterior_predictive_metrics"], posterior_observations)
+                replicates = inference_model.generate_observations_batch(hypergraph, parameters, observations_per_sample)
+                matrix_metrics = []
+                for metric in metrics["posterior_predictive_metrics"]:
+                    if hasattr(metric, "compute_with_batch"):
+                        metric.compute_with_batch(replicates)
+                    else:
+                        matrix_metrics.append(metric)
+
+                if matrix_metrics:
+                    for pair_counts in replicates:
+                        posterior_observations = get_observations_from_pair_counts(pair_counts, hypergraph.get_size())
+                        compute_metrics_with(matrix_metrics, posterior_observations)
 
 
         edgetype_probabilities = get_edgetype_probabilities_of_chain(chain, sample_directory, actual_sample_size)
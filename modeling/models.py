@@ -1,6 +1,8 @@
 from abc import ABC, abstractmethod
 import warnings
 import os
+import queue
+import threading
 import numpy as np
 from shutil import rmtree
 
@@ -10,6 +12,15 @@ from .output import remove_all_chains_but, chain_directory_prefix, erase_sample
 import pygrit
 
 
+def get_observations_from_pair_counts(pair_counts, n):
+    """Symmetric observation matrix from the counts of the pairs (i, j), i<j, in row-major order."""
+    observations = np.zeros((n, n), dtype=np.uint64)
+    rows, columns = np.triu_indices(n, 1)
+    observations[rows, columns] = pair_counts
+    observations[columns, rows] = pair_counts
+    return observations
+
+
 def get_occurences_in_observations(observations):
     counts = np.bincount(observations.astype(np.int64).ravel())
     mask = counts != 0
@@ -67,6 +78,10 @@ class InferenceModel(ABC):
         mu0, mu1, mu2 = parameters[2:]
         return pygrit.generate_poisson_observations(hypergraph, mu0, mu1, mu2, self.with_correlation)
 
+    def generate_observations_batch(self, hypergraph, parameters, replicate_number):
+        return pygrit.generate_poisson_observations_batch(hypergraph, list(parameters[2:]), replicate_number,
+                                                          with_triangles=self.with_correlation)
+
     @abstractmethod
     def get_edgetype_probabilities(self, parameters):
         pass
@@ -100,6 +115,7 @@ class InferenceModel(ABC):
 
     def sample(self, observations, ground_truth, sampling_directory, mu1_smaller_mu2=True, verbose=2):
         erase_sample(sampling_directory)
+        self._configure_sampler()
         maximum_likelihood = None
         best_chain = None
 
@@ -133,6 +149,35 @@ class InferenceModel(ABC):
         if self.config["sampling", "keep only best chain"]:
             remove_all_chains_but(best_chain, sampling_directory)
 
+    def _configure_sampler(self, write_to_disk=True):
+        """Applies every sampling option of the configuration, so that no option set by a previous
+        call is left over. Checkpoints and occupancies are disabled when nothing is written to disk."""
+        self.sampler.set_sample_format(self.config["sampling", "sample format"])
+        self.sampler.set_checkpoint_interval(self.config["sampling", "checkpoint interval"] if write_to_disk else 0)
+        self.sampler.set_canonicalization_interval(self.config["sampling", "canonicalization interval"])
+        self.sampler.set_adaptive_moves(self.config["models", self.name, "adaptive moves"])
+        self.sampler.set_occupancy_accumulation(self.config["sampling", "occupancy accumulation"] and write_to_disk)
+        self._set_convergence_targets()
+
+    def _set_convergence_targets(self):
+        """Chains of "sample" stop early once every target is met. A target of 0 is ignored."""
+        targets = self.config["sampling", "convergence targets"]
+        self.sampler.set_convergence_targets(
+                effective_sample_size = targets["effective sample size"],
+                geweke_z_score        = targets["geweke z-score"],
+                split_r_hat           = targets["split r-hat"]
+            )
+
+    def get_convergence_diagnostics(self, chain):
+        """Effective sample size, Geweke z-score and split-R-hat of the log-likelihood, hyperedge
+        counts and parameters of the last sampled chain. Values are NaN before 64 samples."""
+        diagnostics = self.sampler.get_convergence_diagnostics(chain)
+        parameter_names = self.get_parameter_names()
+        for i, name in enumerate(parameter_names):
+            if f"parameter {i}" in diagnostics:
+                diagnostics[name] = diagnostics.pop(f"parameter {i}")
+        return diagnostics
+
     def _sample_chain(self, initial_parameters, initial_hypergraph, observations, chain, sampling_directory, verbose=2):
         sample = lambda: self.sampler.sample(
                 observations     = observations.tolist(),
@@ -147,6 +192,85 @@ class InferenceModel(ABC):
         with mute_output( stdout=(verbose<2) ):
             return sample()
 
+    def resume_chain(self, observations, chain, sampling_directory, verbose=2):
+        """Continues a chain of "sample" from the last checkpoint of its directory."""
+        self._configure_sampler()
+        chain_directory = os.path.join(sampling_directory, chain_directory_prefix+str(chain)) + "/"
+
+        resume = lambda: self.sampler.resume(
+                observations     = observations.tolist(),
+                # The checkpoint replaces both placeholders before they are used. They only give the number
+                # of parameters and vertices, which must match those of the checkpoint.
+                parameters       = [1.]*len(self.get_parameter_names()),
+                hypergraph       = pygrit.Hypergraph(len(observations)),
+                chain            = chain,
+                sample_size      = self.config["sampling", "sample size"],
+                burnin           = self.config["sampling", "burnin"],
+                output_directory = chain_directory
+            )
+
+        with mute_output( stdout=(verbose<2) ):
+            return resume()
+
+    def stream_chain(self, observations, ground_truth, chain=0, mu1_smaller_mu2=True, sampling_directory=None):
+        """Yields the samples (pygrit.ChainSample) of a chain while it runs. Samples are only written
+        to disk when a sampling directory is given. Closing the generator stops the chain."""
+        initial_hypergraph, initial_parameters = self._get_initial_random_variables(ground_truth, observations, mu1_smaller_mu2)
+
+        samples = queue.Queue(maxsize=self.config["sampling", "sample queue size"])
+        stop_requested = threading.Event()
+        chain_end = object()
+
+        def sink(sample):
+            samples.put(sample)
+            return stop_requested.is_set()
+
+        def sample_chain():
+            try:
+                self.sampler.sample(
+                        observations     = observations.tolist(),
+                        parameters       = initial_parameters,
+                        hypergraph       = initial_hypergraph,
+                        chain            = chain,
+                        sample_size      = self.config["sampling", "sample size"],
+                        burnin           = self.config["sampling", "burnin"],
+                        output_directory = "" if sampling_directory is None else sampling_directory
+                    )
+            except Exception as error:
+                samples.put(error)
+            finally:
+                samples.put(chain_end)
+
+        self._configure_sampler(write_to_disk=sampling_directory is not None)
+        previous_write_samples = self.sampler.get_write_samples()
+        self.sampler.set_write_samples(sampling_directory is not None)
+        self.sampler.set_sample_sink(sink)
+        sampling_thread = threading.Thread(target=sample_chain)
+        sampling_thread.start()
+
+        sample = None
+        try:
+            sample = samples.get()
+            while sample is not chain_end:
+                if isinstance(sample, Exception):
+                    raise sample
+                yield sample
+                sample = samples.get()
+        finally:
+            stop_requested.set()
+            while sample is not chain_end:
+                sample = samples.get()
+            sampling_thread.join()
+            self.sampler.set_sample_sink(None)
+            self.sampler.set_write_samples(previous_write_samples)
+
+    def get_streamed_average_hypergraph(self, observations, ground_truth, chain=0, mu1_smaller_mu2=True):
+        """Average hypergraph of the samples of a chain, accumulated while it runs without writing the samples."""
+        average = pygrit.AverageHypergraph(edge_strength=not self.correlated)
+        for sample in self.stream_chain(observations, ground_truth, chain, mu1_smaller_mu2):
+            average.add(sample.hypergraph)
+        return average.get_average_hypergraph()
+
     def sample_hypergraph_chain(self, observations, ground_truth, sampling_directory,
                                 mu1_smaller_mu2, use_ground_truth, iterations=[0, 1], points=100):
         initial_hypergraph, initial_parameters = self._get_initial_random_variables(
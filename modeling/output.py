@@ -18,7 +18,8 @@ chain_directory_prefix = "chain"
 
 parameters_format = "parameters{}_{}.bin"
 hypergraph_format = "hypergraph{}_{}.bin"
-occurences_format = "occurences{}_edgetype{}.bin"
+occupancy_format = "occupancy{}_edgetype{}.bin"
+move_statistics_format = "movestatistics{}.json"
 chain_directory_format = chain_directory_prefix+"{}"
 
 chain_regex = re.compile(".*"+chain_directory_format.format(r"(\d+)$"))
@@ -129,18 +130,48 @@ def get_tendency_sampling_directory(program_args, dataset_name, model_name, para
                         setup_name, varied_parameter+"="+str(parameter_value), "repetition"+str(observation_id))
 
 
-def get_edgetype_probabilities_of_chain(chain, sample_directory, sample_size):
+def get_edgetype_probabilities_of_chain(chain, sample_directory, sample_size=None):
+    """Proportions of the samples of the chain in which each pair has each edge type. The
+    number of samples is written with the occurences since chains may stop before the
+    sample size. "sample_size" is only used for occurences written without it."""
     chain_directory = os.path.join(sample_directory, chain_directory_format.format(chain))
+    occurences = pygrit.ChainSampleReader.read_occurences(chain_directory, chain)
+
+    if occurences is not None:
+        edgetype1_occurences, edgetype2_occurences, sample_number = occurences
+        if sample_number is not None:
+            sample_size = sample_number
+        elif sample_size is None:
+            raise ValueError(f"The number of samples of chain {chain} wasn't written and no sample size was given.")
+        edgetype0_occurences = np.full_like(edgetype1_occurences, sample_size) - edgetype1_occurences - edgetype2_occurences
+
+        return edgetype0_occurences/sample_size, edgetype1_occurences/sample_size, edgetype2_occurences/sample_size
+
 
-    edgetype1_path = os.path.join(chain_directory, occurences_format.format(chain, 1))
-    edgetype2_path = os.path.join(chain_directory, occurences_format.format(chain, 2))
+def get_occupancy_edgetype_probabilities_of_chain(chain, sample_directory):
+    """Fractions of the Metropolis-Hastings steps after the burn-in spent by each pair in each
+    edge type. Only written when the "occupancy accumulation" sampling option is enabled."""
+    chain_directory = os.path.join(sample_directory, chain_directory_format.format(chain))
+
+    edgetype1_path = os.path.join(chain_directory, occupancy_format.format(chain, 1))
+    edgetype2_path = os.path.join(chain_directory, occupancy_format.format(chain, 2))
 
     if os.path.isfile(edgetype1_path) and os.path.isfile(edgetype2_path):
-        edgetype1_occurences = np.fromfile(edgetype1_path, dtype=np.uint64)
-        edgetype2_occurences = np.fromfile(edgetype2_path, dtype=np.uint64)
-        edgetype0_occurences = np.full_like(edgetype1_occurences, sample_size) - edgetype1_occurences - edgetype2_occurences
+        edgetype1_probabilities = np.fromfile(edgetype1_path, dtype=np.float64)
+        edgetype2_probabilities = np.fromfile(edgetype2_path, dtype=np.float64)
 
-        return edgetype0_occurences/sample_size, edgetype1_occurences/sample_size, edgetype2_occurences/sample_size
+        return 1-edgetype1_probabilities-edgetype2_probabilities, edgetype1_probabilities, edgetype2_probabilities
+
+
+def get_move_statistics_of_chain(chain, sample_directory):
+    """Counts and durations of the Metropolis-Hastings moves of a chain. Only written when
+    pygrit is compiled with GRIT_MOVE_STATISTICS (see pygrit.move_statistics_enabled)."""
+    chain_directory = os.path.join(sample_directory, chain_directory_format.format(chain))
+    move_statistics_path = os.path.join(chain_directory, move_statistics_format.format(chain))
+
+    if os.path.isfile(move_statistics_path):
+        with open(move_statistics_path, "r") as file_stream:
+            return json.load(file_stream)
 
 
 def get_map_estimator(sample_directory, sample_size, model, observations):
@@ -183,8 +214,14 @@ def get_sample_files(sample_directory, sample_size):
             yield sample_element
 
 def get_sample_of_chain(chain, sample_directory, sample_size):
-    for hypergraph_path, parameters_path in get_sample_files_of_chain(chain, sample_directory, sample_size):
-        yield pygrit.Hypergraph.load_from_binary(hypergraph_path), np.fromfile(parameters_path, dtype=np.double)
+    reader = get_chain_sample_reader(chain, sample_directory, sample_size)
+    parameters = reader.get_parameters().copy()  # The reader's parameters are read-only
+    for sample in range(reader.get_sample_number()):
+        yield reader.get_hypergraph(sample), parameters[sample]
+
+def get_chain_sample_reader(chain, sample_directory, sample_size):
+    chain_directory = os.path.join(sample_directory, chain_directory_format.format(chain))
+    return pygrit.ChainSampleReader(chain_directory, chain, sample_size)
 
 def get_sample_files_of_chain(chain, sample_directory, sample_size):
     chain_directory = os.path.join(sample_directory, chain_directory_format.format(chain))
@@ -192,8 +229,10 @@ def get_sample_files_of_chain(chain, sample_directory, sample_size):
         hypergraph_path = os.path.join(chain_directory, hypergraph_format.format(chain, i))
         parameters_path = os.path.join(chain_directory, parameters_format.format(chain, i))
 
-        if os.path.isfile(hypergraph_path+"_edges") and os.path.isfile(hypergraph_path+"_triangles")\
-                and os.path.isfile(parameters_path):
+        hypergraph_exists = os.path.isfile(hypergraph_path) or\
+                (os.path.isfile(hypergraph_path+"_edges") and os.path.isfile(hypergraph_path+"_triangles"))
+
+        if hypergraph_exists and os.path.isfile(parameters_path):
             yield hypergraph_path, parameters_path
 
 
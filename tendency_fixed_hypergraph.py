@@ -4,9 +4,9 @@ import numpy as np
 from mpi4py import MPI
 
 from generation.hypergraph_generation import load_binary_hypergraph
-from generation.observations_generation import generate_observations
+from generation.observations_generation import generate_observations_batch
 from modeling.metrics import compute_and_save_tendency_metrics
-from modeling.models import models, PES, PHG
+from modeling.models import models, PES, PHG, get_observations_from_pair_counts
 from modeling.config import ConfigurationParserWithModels, get_config, get_dataset_name
 from modeling.output import create_output_directories, get_tendency_sampling_directory, observations_filename,\
                             make_sample_a_tarball, remove_current_sample_tarballs
@@ -80,8 +80,10 @@ if __name__ == "__main__":
         if not thread_has_responsability(task_id, rank):
             continue
 
-        for observation_id in observation_id_to_do:
-            observations = generate_observations(hypergraph, config["synthetic generation", "observation process"], observation_parameters, True)
+        replicates = generate_observations_batch(hypergraph, config["synthetic generation", "observation process"],
+                                                 observation_parameters, True, len(observation_id_to_do))
+        for observation_id, pair_counts in zip(observation_id_to_do, replicates):
+            observations = get_observations_from_pair_counts(pair_counts, hypergraph.get_size())
 
             for model in inference_models:
                 sampling_directory = get_tendency_sampling_directory(args, dataset_name, model.name, varied_value, observation_id)